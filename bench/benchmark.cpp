@@ -0,0 +1,352 @@
+/******************************************************************************
+ * Project: Password Manager - Console App
+ * File: benchmark.cpp
+ * Description:
+ *   A small benchmark for the storage layer and the password generator.
+ *   Builds a synthetic vault and reports timings and throughput for the
+ *   save/load pipeline.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.2.0
+ * Author: Ghost
+ * Created On: 10-19-2026
+ * Last Modified: 10-19-2026
+ *****************************************************************************/
+
+#include "custom_io.h"
+#include "HexE.h"
+#include "password_generator.h"
+#include "vault_generator.h"
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Runs `fn` and returns how long it took in milliseconds.
+ */
+template <typename Fn>
+double TimeMs(Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief Prints one result line: name, value and unit.
+ */
+void Report(const std::string& name, double value, const char* unit) {
+    int decimals = value < 1 ? 4 : value < 100 ? 3 : 2; // about 4 significant digits for small values
+    std::cout << "  " << std::left << std::setw(36) << name << std::right << std::setw(14)
+              << std::fixed << std::setprecision(decimals) << value << " " << unit << std::endl;
+}
+
+/**
+ * @brief Builds the synthetic vault every section runs on (see `VaultGenerator`).
+ */
+PasswordMap MakeVault(size_t entries, uint64_t seed) {
+    SyntheticVaultConfig config;
+    config.entries = entries;
+    config.seed = seed;
+    return VaultGenerator::ToMap(VaultGenerator::Generate(config));
+}
+
+/**
+ * @brief Reads a length range written as "min-max" (or a single length).
+ */
+bool ParseRange(const char* text, size_t& min, size_t& max) {
+    char* end;
+    min = max = std::strtoul(text, &end, 10);
+    if (*end == '-') max = std::strtoul(end + 1, &end, 10);
+    return *end == '\0' && min > 0 && min <= max;
+}
+
+/**
+ * @brief Writes a synthetic vault file instead of running the benchmark.
+ *
+ * `password_manager_bench --generate <path> [--entries N] [--seed S] [--keys MIN-MAX] [--values MIN-MAX]
+ * [--uniform] [--duplicates RATIO] [--compress]`
+ */
+int GenerateVaultFile(int argc, char* argv[]) {
+    SyntheticVaultConfig config;
+    bool compress = false;
+    for (int i = 3; i < argc; ++i) {
+        std::string option = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (option == "--compress") compress = true;
+        else if (option == "--uniform") config.keyLengths = LengthDistribution::Uniform;
+        else if (option == "--entries" && hasValue) config.entries = std::strtoul(argv[++i], nullptr, 10);
+        else if (option == "--seed" && hasValue) config.seed = std::strtoull(argv[++i], nullptr, 10);
+        else if (option == "--duplicates" && hasValue) config.duplicateRatio = std::strtod(argv[++i], nullptr);
+        else if (option == "--keys" && hasValue && ParseRange(argv[++i], config.minKeyLength, config.maxKeyLength)) continue;
+        else if (option == "--values" && hasValue && ParseRange(argv[++i], config.minValueLength, config.maxValueLength)) continue;
+        else {
+            std::cerr << "Unknown or invalid option: " << option << std::endl;
+            return 1;
+        }
+    }
+
+    HEXEncryption hexEncrypt;
+    VaultGenerator::Records records = VaultGenerator::Generate(config);
+    if (!VaultGenerator::WriteVault(records, argv[2], hexEncrypt, compress)) {
+        std::cerr << "Could not write " << argv[2] << std::endl;
+        return 1;
+    }
+    std::cout << "Wrote " << records.size() << " records (seed " << config.seed << ") to " << argv[2] << std::endl;
+    return 0;
+}
+
+/**
+ * @brief Compares the plain and the compressed vault formats.
+ */
+void BenchStorage(const PasswordMap& vault, const IEncryption& encrypt) {
+    std::filesystem::path plainPath = std::filesystem::temp_directory_path() / ("pm_bench_plain" FIO_EXT);
+    std::filesystem::path packedPath = std::filesystem::temp_directory_path() / ("pm_bench_packed" FIO_EXT);
+
+    size_t plaintextBytes = 0;
+    for (const auto& [app, pass] : vault) plaintextBytes += app.size() + pass.size();
+
+    double plainSave = TimeMs([&] { CustomIO::SaveToFile(vault, plainPath, encrypt); });
+    double packedSave = TimeMs([&] { CustomIO::SaveToFile(vault, packedPath, encrypt, true); });
+    double plainLoad = TimeMs([&] { CustomIO::LoadFromFile(plainPath, encrypt); });
+    double packedLoad = TimeMs([&] { CustomIO::LoadFromFile(packedPath, encrypt); });
+
+    double plainSize = static_cast<double>(std::filesystem::file_size(plainPath));
+    double packedSize = static_cast<double>(std::filesystem::file_size(packedPath));
+    double megabytes = plaintextBytes / (1024.0 * 1024.0);
+
+    std::cout << "Storage (" << vault.size() << " entries, " << std::fixed << std::setprecision(2) << megabytes << " MiB plaintext)" << std::endl;
+    Report("plain file size", plainSize / (1024.0 * 1024.0), "MiB");
+    Report("compressed file size", packedSize / (1024.0 * 1024.0), "MiB");
+    Report("plain save", plainSave, "ms");
+    Report("compressed save", packedSave, "ms");
+    Report("plain load", plainLoad, "ms");
+    Report("compressed load", packedLoad, "ms");
+    Report("plain load throughput", megabytes / (plainLoad / 1000.0), "MiB/s");
+    Report("compressed load throughput", megabytes / (packedLoad / 1000.0), "MiB/s");
+    Report("disk bytes saved by compression", plainSize / packedSize, "x");
+    Report("effective load throughput gain", plainLoad / packedLoad, "x");
+
+    std::filesystem::remove(plainPath);
+    std::filesystem::remove(packedPath);
+    std::filesystem::remove(CustomIO::GetIndexPath(plainPath));
+    std::filesystem::remove(CustomIO::GetIndexPath(packedPath));
+}
+
+/**
+ * @brief Compares indexed single lookups against loading the whole vault.
+ */
+void BenchLookup(const PasswordMap& vault, const IEncryption& encrypt) {
+    const size_t queries = 1000;
+    std::vector<std::string> present;
+    for (const auto& [app, pass] : vault) {
+        if (present.size() == queries) break;
+        present.push_back(app);
+    }
+    if (present.empty()) return; // nothing to look up
+
+    std::filesystem::path path = std::filesystem::temp_directory_path() / ("pm_bench_lookup" FIO_EXT);
+    CustomIO::SaveToFile(vault, path, encrypt);
+
+    SecureString pass;
+    double fullLoad = TimeMs([&] { CustomIO::LoadFromFile(path, encrypt).count(present.front()); });
+    double hits = TimeMs([&] { for (const auto& app : present) CustomIO::FindInFile(path, app, encrypt, pass); });
+    double misses = TimeMs([&] { for (size_t i = 0; i < queries; ++i) CustomIO::FindInFile(path, "missing" + std::to_string(i), encrypt, pass); });
+
+    std::cout << "Lookup (" << present.size() << " queries)" << std::endl;
+    Report("full load for one lookup", fullLoad, "ms");
+    Report("indexed lookup, present", hits * 1000.0 / present.size(), "us/query");
+    Report("indexed lookup, missing", misses * 1000.0 / queries, "us/query");
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(CustomIO::GetIndexPath(path));
+}
+
+/**
+ * @brief Compares committing a few changed entries by rewriting the vault against appending them.
+ */
+void BenchCommit(const PasswordMap& vault, const IEncryption& encrypt) {
+    std::filesystem::path path = std::filesystem::temp_directory_path() / ("pm_bench_commit" FIO_EXT);
+    CustomIO::SaveToFile(vault, path, encrypt);
+
+    const size_t changed = 10;
+    SecureString newPassword("changed-password");
+    std::vector<VaultChange> changes;
+    for (const auto& [app, pass] : vault) {
+        if (changes.size() == changed) break;
+        changes.push_back({ app, &newPassword });
+    }
+
+    double rewrite = TimeMs([&] { CustomIO::SaveToFile(vault, path, encrypt); });
+    double append = TimeMs([&] { CustomIO::AppendChanges(path, changes, encrypt); });
+
+    std::cout << "Commit (" << changes.size() << " changed entries)" << std::endl;
+    Report("full rewrite", rewrite, "ms");
+    Report("appended changes", append, "ms");
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(CustomIO::GetIndexPath(path));
+}
+
+/**
+ * @brief Compares the inlined HEX storage path against the virtual `IEncryption` fallback.
+ */
+void BenchDispatch(const PasswordMap& vault, const HEXEncryption& hexEncrypt) {
+    std::filesystem::path path = std::filesystem::temp_directory_path() / ("pm_bench_dispatch" FIO_EXT);
+    const IEncryption& dynamicEncrypt = hexEncrypt;
+
+    double staticSave = TimeMs([&] { CustomIO::SaveToFileAs(vault, path, hexEncrypt); });
+    double dynamicSave = TimeMs([&] { CustomIO::SaveToFileAs(vault, path, dynamicEncrypt); });
+    std::string contents = CustomIO::ReadFile(path);
+    double staticParse = TimeMs([&] { CustomIO::ParseVaultAs(contents, hexEncrypt); });
+    double dynamicParse = TimeMs([&] { CustomIO::ParseVaultAs(contents, dynamicEncrypt); });
+
+    std::cout << "Codec dispatch" << std::endl;
+    Report("save, inlined HEXEncryption", staticSave, "ms");
+    Report("save, virtual IEncryption", dynamicSave, "ms");
+    Report("decrypt, inlined HEXEncryption", staticParse, "ms");
+    Report("decrypt, virtual IEncryption", dynamicParse, "ms");
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(CustomIO::GetIndexPath(path));
+}
+
+/**
+ * @brief Per-record encryption calls vs one batch call over every field of the vault.
+ */
+void BenchBatch(const PasswordMap& vault, const IEncryption& encrypt) {
+    std::vector<std::string_view> fields;
+    for (const auto& [app, pass] : vault) {
+        fields.push_back(app);
+        fields.emplace_back(pass.data(), pass.size());
+    }
+
+    std::string arena;
+    std::vector<size_t> offsets;
+    double singleEncrypt = TimeMs([&] {
+        arena.clear();
+        for (std::string_view field : fields) arena.append(encrypt.encryptSecure(SecureString(field.data(), field.size())));
+    });
+    double batchEncrypt = TimeMs([&] { encrypt.encryptBatch(fields.data(), fields.size(), arena, offsets); });
+
+    std::vector<std::string_view> encrypted;
+    for (size_t i = 0; i < fields.size(); ++i) encrypted.emplace_back(arena.data() + offsets[i], offsets[i + 1] - offsets[i]);
+    SecureString plainArena, plain;
+    std::vector<size_t> plainOffsets;
+    double singleDecrypt = TimeMs([&] {
+        plainArena.clear();
+        for (std::string_view field : encrypted) {
+            encrypt.decryptSecure(std::string(field), plain);
+            plainArena.append(plain);
+        }
+    });
+    double batchDecrypt = TimeMs([&] { encrypt.decryptBatch(encrypted.data(), encrypted.size(), plainArena, plainOffsets); });
+
+    std::cout << "Batch encryption (" << fields.size() << " fields)" << std::endl;
+    Report("encrypt, one call per field", singleEncrypt, "ms");
+    Report("encrypt, one batch call", batchEncrypt, "ms");
+    Report("decrypt, one call per field", singleDecrypt, "ms");
+    Report("decrypt, one batch call", batchDecrypt, "ms");
+}
+
+/**
+ * @brief Raw ChaCha20 output, then passwords from one generator and from a parallel batch.
+ */
+void BenchGenerator(size_t count) {
+    ChaCha20Rng rng;
+    rng.SeedFromSystem();
+    std::vector<uint8_t> bytes(64 << 20);
+    double fill = TimeMs([&] { rng.Fill(bytes.data(), bytes.size()); });
+
+    PasswordPolicy policy;
+    PasswordGenerator generator(policy);
+    SecureString pass;
+    double single = TimeMs([&] {
+        for (size_t i = 0; i < count; ++i) generator.Generate(pass);
+    });
+
+    SecureVector<SecureString> passwords;
+    double batch = TimeMs([&] { PasswordGenerator::GenerateBatch(policy, count, passwords); });
+
+    std::cout << "Password generation (" << count << " passwords of " << PG_DEFAULT_LENGTH << " characters)" << std::endl;
+    Report("ChaCha20 output", bytes.size() / 1048576.0 / (fill / 1000), "MiB/s");
+    Report("one generator", count / (single / 1000), "passwords/s");
+    Report("parallel batch", count / (batch / 1000), "passwords/s");
+}
+
+/**
+ * @brief Splits a vault load into the part prefetched behind the password prompt (file read) and the part the user waits for (decrypt).
+ */
+void BenchStartup(const PasswordMap& vault, const IEncryption& encrypt) {
+    std::filesystem::path path = std::filesystem::temp_directory_path() / ("pm_bench_startup" FIO_EXT);
+    CustomIO::SaveToFile(vault, path, encrypt);
+
+    std::string contents;
+    double read = TimeMs([&] { contents = CustomIO::ReadFile(path); });
+    double parse = TimeMs([&] { CustomIO::ParseVault(contents, encrypt); });
+
+    std::cout << "Startup" << std::endl;
+    Report("read (prefetched during prompt)", read, "ms");
+    Report("decrypt (time to first menu)", parse, "ms");
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(CustomIO::GetIndexPath(path));
+}
+
+/**
+ * @brief Compares allocating regular strings against strings from the secure pool.
+ *
+ * Each new string replaces one of `slots` live strings, so allocations and releases alternate.
+ */
+template <typename String>
+double TimeAllocations(size_t count, size_t length, size_t slots = 1024) {
+    std::vector<String> strings(slots);
+    return TimeMs([&] {
+        for (size_t i = 0; i < count; ++i) {
+            String& slot = strings[i % slots];
+            slot = String(length, 'x'); // frees the previous string of this slot, allocates a new one
+        }
+    });
+}
+
+void BenchAllocation() {
+    const size_t count = 1000000;
+    const size_t largeCount = 20000;
+    const size_t largeSlots = 16; // the large blocks are locked, keep few of them alive
+    TimeAllocations<SecureString>(count, 24); // warm the pool so the timing sees the steady state
+    TimeAllocations<SecureString>(largeCount, 64 * 1024, largeSlots);
+
+    std::cout << "Allocation (" << count << " strings of 24 and 200 bytes, " << largeCount << " of 64 KiB)" << std::endl;
+    Report("std::string, 24 bytes", TimeAllocations<std::string>(count, 24) * 1e6 / count, "ns/alloc");
+    Report("SecureString, 24 bytes", TimeAllocations<SecureString>(count, 24) * 1e6 / count, "ns/alloc");
+    Report("std::string, 200 bytes", TimeAllocations<std::string>(count, 200) * 1e6 / count, "ns/alloc");
+    Report("SecureString, 200 bytes", TimeAllocations<SecureString>(count, 200) * 1e6 / count, "ns/alloc");
+    Report("std::string, 64 KiB", TimeAllocations<std::string>(largeCount, 64 * 1024, largeSlots) * 1e6 / largeCount, "ns/alloc");
+    Report("SecureString, 64 KiB", TimeAllocations<SecureString>(largeCount, 64 * 1024, largeSlots) * 1e6 / largeCount, "ns/alloc");
+}
+
+int main(int argc, char* argv[]) {
+    if (argc >= 3 && std::string(argv[1]) == "--generate") return GenerateVaultFile(argc, argv);
+
+    size_t entries = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100000;
+    if (entries == 0) {
+        std::cerr << "Usage: password_manager_bench [entries > 0] or --generate <path> [options]" << std::endl;
+        return 1;
+    }
+    HEXEncryption hexEncrypt;
+
+    auto vault = MakeVault(entries, 42);
+    BenchStorage(vault, hexEncrypt);
+    BenchLookup(vault, hexEncrypt);
+    BenchCommit(vault, hexEncrypt);
+    BenchStartup(vault, hexEncrypt);
+    BenchDispatch(vault, hexEncrypt);
+    BenchBatch(vault, hexEncrypt);
+    BenchGenerator(entries);
+    BenchAllocation();
+}
@@ -0,0 +1,118 @@
+#!/bin/bash
+
+# Runs the benchmark and compares the product metrics against a stored baseline.
+#
+# Usage: bench/perf_check.sh [--bench PATH] [--baseline FILE] [--threshold PERCENT] [--noise N] [--runs N] [--entries N] [--update]
+#
+# Each metric keeps its median over the runs, along with its median absolute deviation (MAD) as
+# a measure of the run to run noise. Only what a user waits for is gated: loading the vault,
+# lookups, commits and startup. A gated metric is a regression when it is worse than the baseline
+# by more than the threshold AND by more than N times the combined MAD of the baseline and the
+# current runs, so a metric that moves within its own noise is not flagged. The other metrics
+# (sizes, codec and allocator micro benchmarks) are printed for information only. The script
+# exits with 1 on a regression. --update stores the results as the new baseline instead.
+# Baselines only compare on the machine they were recorded on.
+
+set -e
+
+ROOT_DIR="$(cd "$(dirname "$0")/.." && pwd)"
+BENCH="$ROOT_DIR/out/Release/password_manager_bench"
+BASELINE="$ROOT_DIR/bench/baseline.txt"
+THRESHOLD=5
+NOISE=3
+RUNS=7
+ENTRIES=100000
+UPDATE=0
+
+# Metrics that gate, matched against "section: metric"
+GATED='^Storage: (plain|compressed) load$|^(Lookup|Commit|Startup): '
+
+while [[ $# -gt 0 ]]; do
+    case "$1" in
+        --bench) BENCH="$2"; shift 2 ;;
+        --baseline) BASELINE="$2"; shift 2 ;;
+        --threshold) THRESHOLD="$2"; shift 2 ;;
+        --noise) NOISE="$2"; shift 2 ;;
+        --runs) RUNS="$2"; shift 2 ;;
+        --entries) ENTRIES="$2"; shift 2 ;;
+        --update) UPDATE=1; shift ;;
+        *) echo "Unknown option: $1"; exit 2 ;;
+    esac
+done
+
+if [[ ! -x "$BENCH" ]]; then
+    echo "Benchmark not found: $BENCH (build it with compile.sh Release, LTO or PGO)"
+    exit 2
+fi
+
+# Prints "section: metric<TAB>value<TAB>unit" for every result line of a benchmark run
+collect() {
+    awk '
+        /^[^ ]/ { section = $0; sub(/ \(.*/, "", section); next }
+        /^  / && NF >= 3 {
+            unit = $NF; value = $(NF - 1)
+            name = $0; sub(/^ +/, "", name); sub(/ +[^ ]+ +[^ ]+ *$/, "", name)
+            printf "%s: %s\t%s\t%s\n", section, name, value, unit
+        }'
+}
+
+# Results are "metric<TAB>median<TAB>unit<TAB>MAD", in benchmark order
+RESULTS="$(mktemp)"
+trap 'rm -f "$RESULTS"' EXIT
+for ((run = 1; run <= RUNS; run++)); do
+    echo "Benchmark run $run/$RUNS ($ENTRIES entries)..." >&2
+    "$BENCH" "$ENTRIES" | collect
+done | awk -F '\t' '
+    function median(list, n,    sorted, i, j, v) {
+        for (i = 1; i <= n; i++) {
+            v = list[i]
+            for (j = i - 1; j >= 1 && sorted[j] > v; j--) sorted[j + 1] = sorted[j]
+            sorted[j + 1] = v
+        }
+        return n % 2 ? sorted[(n + 1) / 2] : (sorted[n / 2] + sorted[n / 2 + 1]) / 2
+    }
+    !($1 in count) { order[n++] = $1; unit[$1] = $3 }
+    { values[$1, ++count[$1]] = $2 }
+    END {
+        for (i = 0; i < n; i++) {
+            key = order[i]; c = count[key]
+            for (j = 1; j <= c; j++) list[j] = values[key, j]
+            m = median(list, c)
+            for (j = 1; j <= c; j++) list[j] = list[j] > m ? list[j] - m : m - list[j]
+            printf "%s\t%.6g\t%s\t%.6g\n", key, m, unit[key], median(list, c)
+        }
+    }
+' > "$RESULTS"
+
+if [[ "$UPDATE" == 1 ]]; then
+    cp "$RESULTS" "$BASELINE"
+    echo "Baseline written to $BASELINE"
+    exit 0
+fi
+
+if [[ ! -f "$BASELINE" ]]; then
+    echo "No baseline at $BASELINE, record one with --update"
+    exit 2
+fi
+
+awk -F '\t' -v threshold="$THRESHOLD" -v noise="$NOISE" -v gated="$GATED" '
+    function higher(unit) { return unit ~ /\/s$/ || unit == "x" }
+    NR == FNR { base[$1] = $2; baseMad[$1] = $4 + 0; next }
+    !($1 in base) { printf "  %-60s %16s %16.4f %-10s (new)\n", $1, "-", $2, $3; next }
+    {
+        old = base[$1]; new = $2
+        # Positive change is worse, whatever the direction of the unit
+        delta = higher($3) ? old - new : new - old
+        change = old == 0 ? 0 : delta / old * 100
+        margin = noise * (baseMad[$1] + $4)
+        status = ""
+        if ($1 !~ gated) status = "  (info)"
+        else if (change > threshold && delta > margin) { status = "  REGRESSION"; regressions++ }
+        else if (change > threshold) status = "  (within noise)"
+        printf "  %-60s %16.4f %16.4f %-10s %+7.2f%% +/-%.4f%s\n", $1, old, new, $3, change, margin, status
+    }
+    END {
+        if (regressions > 0) { printf "%d gated metric(s) regressed by more than %s%% and %s times their noise\n", regressions, threshold, noise; exit 1 }
+        printf "No gated regression above %s%% and %s times the noise\n", threshold, noise
+    }
+' "$BASELINE" "$RESULTS"
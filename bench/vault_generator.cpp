@@ -0,0 +1,108 @@
+/******************************************************************************
+ * Project: Password Manager - Console App
+ * File: vault_generator.cpp
+ * Description:
+ *   Seeded generator of synthetic vaults, so benchmarks and experiments run
+ *   on the same inputs on every machine.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.2.0
+ * Author: Ghost
+ * Created On: 10-19-2026
+ * Last Modified: 10-19-2026
+ *****************************************************************************/
+
+#include "vault_generator.h"
+#include "custom_io.h"
+#include "password_generator.h"
+#include "vault_index.h"
+#include <algorithm>
+#include <fstream>
+
+#define VG_RATIO_SCALE (1u << 24) // resolution of the duplicate ratio draw
+
+// Draws a length in [min, max] following `distribution`.
+static size_t DrawLength(ChaCha20Rng& rng, size_t min, size_t max, LengthDistribution distribution) {
+    uint64_t span = static_cast<uint64_t>(std::max(min, max) - min) + 1;
+    uint64_t draw = rng.Uniform(static_cast<uint32_t>(span));
+    if (distribution == LengthDistribution::Skewed) draw = draw * draw / span;
+    return min + static_cast<size_t>(draw);
+}
+
+VaultGenerator::Records VaultGenerator::Generate(const SyntheticVaultConfig& config) {
+    static const char* prefixes[] = { "mail", "login", "accounts", "portal", "app", "www", "secure", "id" };
+    static const char* suffixes[] = { ".com", ".net", ".org", ".io", ".co.uk", ".dev" };
+    static const char* words[] = { "service", "cloud", "shop", "bank", "mail", "store", "media", "games", "news", "travel", "health", "work", "home", "music", "photo", "social" };
+    static const char charset[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789!@#$%^&*";
+
+    uint8_t key[PG_KEY_SIZE] = {};
+    for (int i = 0; i < 8; ++i) key[i] = static_cast<uint8_t>(config.seed >> (i * 8));
+    ChaCha20Rng rng;
+    rng.Seed(key);
+
+    uint32_t duplicateThreshold = static_cast<uint32_t>(std::clamp(config.duplicateRatio, 0.0, 1.0) * VG_RATIO_SCALE);
+    size_t nextId = 0;
+    Records records;
+    records.reserve(config.entries);
+
+    for (size_t i = 0; i < config.entries; ++i) {
+        std::string app;
+        if (i > 0 && rng.Uniform(VG_RATIO_SCALE) < duplicateThreshold) {
+            app = records[rng.Uniform(static_cast<uint32_t>(i))].first;
+        }
+        else {
+            // <prefix>.<words><id><suffix>: the words pad the name to the drawn length, the id keeps it unique
+            const char* prefix = prefixes[rng.Uniform(8)];
+            const char* suffix = suffixes[rng.Uniform(6)];
+            std::string id = std::to_string(nextId++);
+            size_t length = DrawLength(rng, config.minKeyLength, config.maxKeyLength, config.keyLengths);
+            size_t fixed = std::char_traits<char>::length(prefix) + 1 + id.size() + std::char_traits<char>::length(suffix);
+            std::string filler;
+            while (filler.size() + fixed < length) filler.append(words[rng.Uniform(16)]);
+            filler.resize(length > fixed ? length - fixed : 0);
+            app.append(prefix).append(".").append(filler).append(id).append(suffix);
+        }
+
+        SecureString pass(DrawLength(rng, config.minValueLength, config.maxValueLength, config.valueLengths), ' ');
+        for (char& c : pass) c = charset[rng.Uniform(sizeof(charset) - 1)];
+        records.emplace_back(std::move(app), std::move(pass));
+    }
+    return records;
+}
+
+PasswordMap VaultGenerator::ToMap(const Records& records) {
+    PasswordMap map;
+    map.reserve(records.size());
+    for (const auto& [app, pass] : records) map[app] = pass;
+    return map;
+}
+
+bool VaultGenerator::WriteVault(const Records& records, const std::filesystem::path& path, const IEncryption& encrypt, bool compress) {
+    if (compress) return CustomIO::SaveToFile(ToMap(records), path, encrypt, true);
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) return false;
+
+    std::string out;
+    std::vector<IndexEntry> index;
+    index.reserve(records.size());
+    CustomIO::AppendFormatLine(out);
+    for (const auto& [app, pass] : records) {
+        std::string encryptedApp = encrypt.encrypt(app);
+        index.push_back({ VaultIndex::HashKey(encryptedApp), static_cast<uint64_t>(out.size()) });
+        CustomIO::AppendRecordLine(out, encryptedApp, encrypt.encryptSecure(pass));
+    }
+    file.write(out.data(), static_cast<std::streamsize>(out.size()));
+    file.close();
+
+    std::filesystem::path indexPath = CustomIO::GetIndexPath(path);
+    if (!file || !VaultIndex::Write(indexPath, index, path, out.size())) {
+        std::error_code error;
+        std::filesystem::remove(indexPath, error);
+    }
+    return static_cast<bool>(file);
+}
@@ -0,0 +1,86 @@
+/******************************************************************************
+ * Project: Password Manager - Console App
+ * File: vault_generator.h
+ * Description:
+ *   Seeded generator of synthetic vaults, so benchmarks and experiments run
+ *   on the same inputs on every machine.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.2.0
+ * Author: Ghost
+ * Created On: 10-19-2026
+ * Last Modified: 10-19-2026
+ *****************************************************************************/
+
+#pragma once
+#include "IEncryption.h"
+#include "secure_allocator.h"
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief How lengths are drawn between a minimum and a maximum.
+ */
+enum class LengthDistribution {
+    Uniform, // every length equally likely
+    Skewed   // short lengths more likely (the square of a uniform draw), like real app names
+};
+
+/**
+ * @struct SyntheticVaultConfig
+ * @brief Shape of a synthetic vault. The same config always gives the same records.
+ */
+struct SyntheticVaultConfig {
+    size_t entries = 100000;  // records generated, duplicates included
+    uint64_t seed = 42;
+    size_t minKeyLength = 12; // app names, e.g. "mail.jdkwq417.com"
+    size_t maxKeyLength = 40;
+    LengthDistribution keyLengths = LengthDistribution::Skewed;
+    size_t minValueLength = 12; // passwords
+    size_t maxValueLength = 20;
+    LengthDistribution valueLengths = LengthDistribution::Uniform;
+    double duplicateRatio = 0.0; // fraction of records repeating an earlier name with a new password
+};
+
+/**
+ * @class VaultGenerator
+ * @brief Generates synthetic vault records from a `SyntheticVaultConfig`.
+ *
+ * Randomness comes from `ChaCha20Rng` seeded with the config seed, never from the standard
+ * library distributions, whose output differs between standard library implementations. The
+ * records are therefore identical on every platform and compiler.
+ *
+ * Names share a few prefixes and domain suffixes, so the vault compresses like a real one.
+ * Every name is unique except the duplicates asked for by `duplicateRatio`.
+ */
+class VaultGenerator {
+public:
+    using Records = SecureVector<std::pair<std::string, SecureString>>;
+
+    /**
+     * @brief Generates the records of `config`, in file order.
+     */
+    static Records Generate(const SyntheticVaultConfig& config);
+
+    /**
+     * @brief Collects records into a map, a repeated name keeps its last password (as loading does).
+     */
+    static PasswordMap ToMap(const Records& records);
+
+    /**
+     * @brief Writes records as a vault file.
+     *
+     * Plain vaults get one line per record, duplicates included. Compressed vaults are written by
+     * `CustomIO::SaveToFile`, which stores a map, so duplicates are collapsed first.
+     *
+     * @return `false` if the file could not be written.
+     */
+    static bool WriteVault(const Records& records, const std::filesystem::path& path, const IEncryption& encrypt, bool compress = false);
+};
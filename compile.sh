@@ -3,30 +3,66 @@
 # Ensure script stops on errors
 set -e
 
-# Require build flag
-if [[ "$1" != "Release" && "$1" != "Debug" ]]; then
-    echo "Usage: build.sh Release or Debug"
-    exit 1
-fi
-
-BUILD_TYPE="$1"
-BUILD_DIR="out/$BUILD_TYPE"
-
-# Create build directory if it does not exist
-if [[ ! -d "$BUILD_DIR" ]]; then
-    echo "Creating build directory..."
-    mkdir -p "$BUILD_DIR"
-fi
-
-# Change directory to build folder
-cd "$BUILD_DIR"
-
-# Run CMake configuration if not already configured
-if [[ ! -f "CMakeCache.txt" ]]; then
+# Build modes:
+#   Debug, Release  plain builds
+#   LTO             Release with link time optimization
+#   PGO             LTO build optimized with profiles recorded while running the benchmark
+#   Multiarch       one LTO build per x86-64 level (password_manager-<level>), run.sh picks the best one
+USAGE="Usage: compile.sh Release, Debug, LTO, PGO or Multiarch"
+case "$1" in
+    Release|Debug|LTO|PGO|Multiarch) ;;
+    *) echo "$USAGE"; exit 1 ;;
+esac
+
+BUILD_MODE="$1"
+ROOT_DIR="$(cd "$(dirname "$0")" && pwd)"
+BUILD_DIR="$ROOT_DIR/out/$BUILD_MODE"
+MARCH_LEVELS="x86-64 x86-64-v2 x86-64-v3 x86-64-v4"
+PGO_TRAIN_ENTRIES="${PGO_TRAIN_ENTRIES:-100000}" # vault size of the training run
+
+# Configures and builds one variant: build directory, then extra CMake options
+build() {
+    local dir="$1"
+    shift
+    mkdir -p "$dir"
     echo "Configuring CMake..."
-    cmake -DCMAKE_BUILD_TYPE="$BUILD_TYPE" ../..
-fi
+    cmake -S "$ROOT_DIR" -B "$dir" -DPM_OUTPUT_DIR="$BUILD_DIR" "$@" > /dev/null
+    cmake --build "$dir" --config "$BUILD_TYPE"
+}
+
+if [[ "$BUILD_MODE" == "Debug" ]]; then BUILD_TYPE="Debug"; else BUILD_TYPE="Release"; fi
+echo "Building in $BUILD_MODE mode..."
+
+case "$BUILD_MODE" in
+    Debug|Release)
+        build "$BUILD_DIR" -DCMAKE_BUILD_TYPE="$BUILD_TYPE" -DPM_BUILD_BENCHMARKS="$([[ $BUILD_MODE == Release ]] && echo ON || echo OFF)"
+        ;;
+    LTO)
+        build "$BUILD_DIR" -DCMAKE_BUILD_TYPE=Release -DPM_ENABLE_LTO=ON -DPM_BUILD_BENCHMARKS=ON
+        ;;
+    PGO)
+        # 1. Instrumented build, profiles of an earlier training are dropped
+        rm -rf "$BUILD_DIR/pgo"
+        build "$BUILD_DIR" -DCMAKE_BUILD_TYPE=Release -DPM_ENABLE_LTO=ON -DPM_BUILD_BENCHMARKS=ON -DPM_PGO=GENERATE
+
+        # 2. Training run: the benchmark drives the storage, lookup, commit and generator paths
+        echo "Training on a $PGO_TRAIN_ENTRIES entry vault..."
+        "$BUILD_DIR/password_manager_bench" "$PGO_TRAIN_ENTRIES" > /dev/null
+        if compgen -G "$BUILD_DIR/pgo/*.profraw" > /dev/null; then # Clang writes raw profiles that are merged first
+            llvm-profdata merge -output="$BUILD_DIR/pgo/default.profdata" "$BUILD_DIR"/pgo/*.profraw
+        fi
 
-# Build the project
-echo "Building in $BUILD_TYPE mode..."
-cmake --build . --config "$BUILD_TYPE"
+        # 3. Optimized build, in the same directory so the profiles match the objects
+        build "$BUILD_DIR" -DPM_PGO=USE
+        ;;
+    Multiarch)
+        if [[ "$(uname -m)" != "x86_64" ]]; then
+            echo "Multiarch builds target x86-64 levels, this machine is $(uname -m)"
+            exit 1
+        fi
+        for level in $MARCH_LEVELS; do
+            echo "Building for $level..."
+            build "$BUILD_DIR/$level" -DCMAKE_BUILD_TYPE=Release -DPM_ENABLE_LTO=ON -DPM_MARCH="$level"
+        done
+        ;;
+esac
@@ -0,0 +1,57 @@
+/******************************************************************************
+ * Project: Password Manager - Console App
+ * File: fuzz_hex_decode.cpp
+ * Description:
+ *   Fuzz target for the HEX decoder: every decoding entry point must agree,
+ *   and whatever decodes must encode back to the same digits.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.2.0
+ * Author: Ghost
+ * Created On: 10-19-2026
+ * Last Modified: 10-19-2026
+ *****************************************************************************/
+
+#include "HexE.h"
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <vector>
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    static const HEXEncryption hexEncrypt;
+    std::string input(reinterpret_cast<const char*>(data), size);
+
+    std::string decoded(size / 2, '\0');
+    bool valid = HEXEncryption::DecodeTo(input.data(), input.size(), decoded.data());
+
+    // decrypt returns an empty string for rejected input
+    std::string decrypted = hexEncrypt.decrypt(input);
+    if (valid ? decrypted != decoded : !decrypted.empty()) std::abort();
+
+    SecureString secure;
+    if (hexEncrypt.decryptSecure(input, secure) != valid) std::abort();
+    if (valid && std::string_view(secure.data(), secure.size()) != decoded) std::abort();
+
+    // The batch decoder sees the input split in two, it rejects the batch if either half is rejected
+    size_t half = (size / 2) & ~static_cast<size_t>(1);
+    std::string_view halves[2] = { std::string_view(input).substr(0, half), std::string_view(input).substr(half) };
+    std::string arena;
+    std::vector<size_t> offsets;
+    if (HEXEncryption::DecodeBatchTo(halves, 2, arena, offsets) != valid) std::abort();
+    if (valid && arena != decoded) std::abort();
+
+    // Round trip: the encoder writes upper case digits
+    if (valid) {
+        std::string encoded = hexEncrypt.encrypt(decoded);
+        for (char& c : input) c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+        if (encoded != input) std::abort();
+    }
+    return 0;
+}
@@ -0,0 +1,72 @@
+/******************************************************************************
+ * Project: Password Manager - Console App
+ * File: fuzz_parse_vault.cpp
+ * Description:
+ *   Fuzz target for the vault parser: arbitrary bytes are parsed as a vault
+ *   file, through both the inlined HEX path and the virtual fallback.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.2.0
+ * Author: Ghost
+ * Created On: 10-19-2026
+ * Last Modified: 10-19-2026
+ *****************************************************************************/
+
+#include "custom_io.h"
+#include "HexE.h"
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class ForwardingEncryption
+ * @brief Hides the concrete type of `HEXEncryption`, so `ParseVault` takes the `IEncryption` path
+ * with the same results.
+ */
+class ForwardingEncryption final : public IEncryption {
+public:
+    std::string encrypt(const std::string& input) const override { return m_Hex.encrypt(input); }
+    std::string decrypt(const std::string& input) const override { return m_Hex.decrypt(input); }
+    std::string encryptSecure(const SecureString& input) const override { return m_Hex.encryptSecure(input); }
+    bool decryptSecure(const std::string& input, SecureString& output) const override { return m_Hex.decryptSecure(input, output); }
+
+    void encryptBatch(const std::string_view* inputs, size_t count, std::string& arena, std::vector<size_t>& offsets) const override {
+        m_Hex.encryptBatch(inputs, count, arena, offsets);
+    }
+
+    bool decryptBatch(const std::string_view* inputs, size_t count, SecureString& arena, std::vector<size_t>& offsets) const override {
+        return m_Hex.decryptBatch(inputs, count, arena, offsets);
+    }
+
+private:
+    HEXEncryption m_Hex;
+};
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    static const HEXEncryption hexEncrypt;
+    static const ForwardingEncryption virtualEncrypt;
+    std::string contents(reinterpret_cast<const char*>(data), size);
+
+    EntryMetadata metadata, virtualMetadata;
+    PasswordMap passwords = CustomIO::ParseVault(contents, hexEncrypt, &metadata);
+    PasswordMap virtualPasswords = CustomIO::ParseVault(contents, virtualEncrypt, &virtualMetadata);
+
+    // Both paths implement the same format, any difference is a bug
+    if (passwords != virtualPasswords || metadata.Size() != virtualMetadata.Size()) std::abort();
+
+    // Metadata read from a file must serialize back to a table that reads the same
+    SecureString columns;
+    metadata.Serialize(columns);
+    EntryMetadata reread;
+    if (!reread.Deserialize(columns.data(), columns.size()) || reread.Size() != metadata.Size()) std::abort();
+
+    metadata.Reconcile(passwords);
+    if (metadata.Size() != passwords.size()) std::abort();
+    return 0;
+}
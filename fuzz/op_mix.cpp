@@ -0,0 +1,254 @@
+/******************************************************************************
+ * Project: Password Manager - Console App
+ * File: op_mix.cpp
+ * Description:
+ *   Drives a PasswordManager through a random mix of operations, commits and
+ *   reloads, and checks the vault against a plain std::map after each one.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.2.0
+ * Author: Ghost
+ * Created On: 10-19-2026
+ * Last Modified: 10-19-2026
+ *****************************************************************************/
+
+#include "custom_io.h"
+#include "custom_terminal.h"
+#include "HexE.h"
+#include "password_manager.h"
+#include "vault_index.h"
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#define OPMIX_GENERATED "\x01generated" // model password of an entry whose generated password is not known yet
+#define OPMIX_TAGS 6                     // distinct tags used, well below EM_MAX_TAGS
+
+/**
+ * @struct ModelEntry
+ * @brief What the vault should hold for one app name.
+ */
+struct ModelEntry {
+    std::string password;
+    std::string username;
+    std::vector<std::string> tags; // sorted
+};
+
+using Model = std::map<std::string, ModelEntry>;
+
+/**
+ * @class OpMix
+ * @brief Applies random operations to a `PasswordManager` and to a `Model`, and compares the vault
+ * file against the model after every commit and reload.
+ */
+class OpMix {
+public:
+    OpMix(uint64_t seed, bool compress)
+        : m_Rng(seed), m_Compress(compress),
+          m_Path(std::filesystem::temp_directory_path() / ("pm_opmix_" + std::to_string(seed) + FIO_EXT)) {
+        Remove();
+        m_Manager = std::make_unique<PasswordManager>(PasswordMap());
+    }
+
+    ~OpMix() { Remove(); }
+
+    /**
+     * @brief Runs `count` operations, returns `false` at the first mismatch.
+     */
+    bool Run(size_t count) {
+        m_Names = std::max<size_t>(16, count / 8); // small enough for names to come back
+        for (m_Op = 0; m_Op < count; ++m_Op) {
+            uint64_t roll = m_Rng() % 100;
+            bool ok = true;
+            if (roll < 45) Add();
+            else if (roll < 65) Delete();
+            else if (roll < 70) Generate();
+            else if (roll < 90) ok = Commit();
+            else ok = Reload();
+            CustomTerminal::BUFFER.clear(); // messages are not looked at
+            if (!ok) return false;
+        }
+        return Reload();
+    }
+
+    size_t Commits() const { return m_Commits; }
+    size_t Appended() const { return m_Appended; }
+
+private:
+    std::string Name() {
+        size_t id = m_Rng() % m_Names;
+        std::string name = "app" + std::to_string(id);
+        if (id % 7 == 0) name += std::string(24, 'x'); // longer than the small string buffer
+        if (id % 11 == 0) name += " |~#+-!"; // characters the file format uses
+        return name;
+    }
+
+    std::string Text(size_t maxLength) {
+        std::string text(1 + m_Rng() % maxLength, '\0');
+        for (char& c : text) c = static_cast<char>(m_Rng() % 256);
+        return text;
+    }
+
+    std::vector<std::string> Tags() {
+        std::vector<std::string> tags;
+        for (int i = 0; i < OPMIX_TAGS; ++i) {
+            if (m_Rng() % 3 == 0) tags.push_back("tag" + std::to_string(i));
+        }
+        return tags;
+    }
+
+    void Add() {
+        std::string app = Name(), pass = Text(40);
+        std::string username = m_Rng() % 3 == 0 ? "user" + std::to_string(m_Rng() % 100) : "";
+        std::vector<std::string> tags = m_Rng() % 4 == 0 ? Tags() : std::vector<std::string>();
+        std::string joined;
+        for (const std::string& tag : tags) joined += (joined.empty() ? "" : ", ") + tag;
+
+        m_Manager->AddPassword(app, pass, username, joined);
+        auto found = m_Model.find(app);
+        if (found == m_Model.end()) found = m_Model.emplace(app, ModelEntry()).first;
+        found->second.password = pass;
+        if (!username.empty()) found->second.username = username;
+        if (!tags.empty()) found->second.tags = tags;
+    }
+
+    void Delete() {
+        std::string app = Name();
+        m_Manager->DeletePassword(app);
+        m_Model.erase(app);
+    }
+
+    void Generate() {
+        std::vector<std::string> apps;
+        for (uint64_t i = m_Rng() % 4; i-- > 0;) apps.push_back(Name());
+        PasswordPolicy policy;
+        m_Manager->GeneratePasswords(apps, policy);
+        for (const std::string& app : apps) m_Model[app].password = OPMIX_GENERATED;
+    }
+
+    bool Commit() {
+        bool hadChanges = m_Manager->HasChanges();
+        uint64_t sizeBefore = Size();
+        bool saved = m_Manager->CommitData(m_Path, m_Encryption, m_Compress);
+        if (saved != hadChanges) return Fail("CommitData returned " + std::to_string(saved) + " with changes " + std::to_string(hadChanges));
+        if (saved) {
+            m_Commits++;
+            uint64_t indexedSize = 0;
+            bool appended = VaultIndex::ReadIndexedSize(CustomIO::GetIndexPath(m_Path), m_Path, Size(), indexedSize) &&
+                            indexedSize < Size() && sizeBefore > 0;
+            m_Appended += appended;
+        }
+        return Check();
+    }
+
+    // Commits, then replaces the manager with one loaded from the file, as the app does on start
+    bool Reload() {
+        if (!Commit()) return false;
+        EntryMetadata metadata;
+        PasswordMap passwords = CustomIO::LoadFromFile(m_Path, m_Encryption, &metadata);
+        m_Manager = std::make_unique<PasswordManager>(std::move(passwords), std::move(metadata));
+        if (m_Manager->HasChanges()) return Fail("a reloaded vault has changes");
+        return true;
+    }
+
+    // Compares the file with the model, learning the generated passwords
+    bool Check() {
+        EntryMetadata metadata;
+        PasswordMap passwords = CustomIO::LoadFromFile(m_Path, m_Encryption, &metadata);
+        if (passwords.size() != m_Model.size()) {
+            return Fail("vault holds " + std::to_string(passwords.size()) + " entries, model " + std::to_string(m_Model.size()));
+        }
+
+        for (auto& [app, entry] : m_Model) {
+            auto it = passwords.find(app);
+            if (it == passwords.end()) return Fail("missing entry " + app);
+            std::string stored(it->second.data(), it->second.size());
+            if (entry.password == OPMIX_GENERATED) {
+                if (stored.size() != PG_DEFAULT_LENGTH) return Fail("generated password of " + app + " has the wrong length");
+                entry.password = stored;
+            }
+            if (stored != entry.password) return Fail("wrong password for " + app);
+
+            size_t row = metadata.Row(app);
+            if (row == EM_NO_ROW) return Fail("no metadata for " + app);
+            std::vector<std::string> tags = metadata.Tags(row);
+            std::sort(tags.begin(), tags.end());
+            if (metadata.Username(row) != entry.username) return Fail("wrong username for " + app);
+            if (tags != entry.tags) return Fail("wrong tags for " + app);
+        }
+        if (metadata.Size() != passwords.size()) return Fail("metadata has rows of removed entries");
+
+        // Single lookups go through the index and the appended changes
+        for (int i = 0; i < 4; ++i) {
+            std::string app = Name();
+            SecureString pass;
+            auto it = m_Model.find(app);
+            bool found = CustomIO::FindInFile(m_Path, app, m_Encryption, pass);
+            if (found != (it != m_Model.end())) return Fail("FindInFile disagrees on " + app);
+            if (found && std::string(pass.data(), pass.size()) != it->second.password) return Fail("FindInFile returned a wrong password for " + app);
+        }
+
+        VerifyReport report;
+        if (Size() > 0 && (!CustomIO::VerifyFile(m_Path, report) || !report.damaged.empty())) return Fail("VerifyFile found damage");
+        return true;
+    }
+
+    bool Fail(const std::string& reason) {
+        std::cerr << "Mismatch after operation " << m_Op << ": " << reason << std::endl;
+        return false;
+    }
+
+    uint64_t Size() const {
+        std::error_code error;
+        uint64_t size = std::filesystem::file_size(m_Path, error);
+        return error ? 0 : size;
+    }
+
+    void Remove() {
+        std::error_code error;
+        std::filesystem::remove(m_Path, error);
+        std::filesystem::remove(CustomIO::GetIndexPath(m_Path), error);
+    }
+
+    std::mt19937_64 m_Rng;
+    bool m_Compress;
+    std::filesystem::path m_Path;
+    HEXEncryption m_Encryption;
+    std::unique_ptr<PasswordManager> m_Manager;
+    Model m_Model;
+    size_t m_Names = 16;
+    size_t m_Op = 0;
+    size_t m_Commits = 0;
+    size_t m_Appended = 0;
+};
+
+/**
+ * @brief Usage: password_manager_opmix [seed] [operations] [--compress]
+ *
+ * Returns `0` if the vault matched the model after every commit and reload, `1` at the first
+ * mismatch (the operation number is printed, rerun with the same seed to reproduce it).
+ */
+int main(int argc, char* argv[]) {
+    uint64_t seed = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1;
+    size_t operations = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 10000;
+    bool compress = argc > 3 && std::string(argv[3]) == "--compress";
+
+    OpMix mix(seed, compress);
+    if (!mix.Run(operations)) {
+        std::cerr << "Seed " << seed << ", " << operations << " operations" << (compress ? ", compressed" : "") << ": FAILED" << std::endl;
+        return 1;
+    }
+    std::cout << "Seed " << seed << ", " << operations << " operations" << (compress ? ", compressed" : "") << ": OK ("
+              << mix.Commits() << " commits, " << mix.Appended() << " appended)" << std::endl;
+    return 0;
+}
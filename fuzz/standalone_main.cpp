@@ -0,0 +1,195 @@
+/******************************************************************************
+ * Project: Password Manager - Console App
+ * File: standalone_main.cpp
+ * Description:
+ *   Replays and mutates inputs through a fuzz target, for compilers without
+ *   libFuzzer.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.2.0
+ * Author: Ghost
+ * Created On: 10-19-2026
+ * Last Modified: 10-19-2026
+ *****************************************************************************/
+
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(__has_include)
+#if __has_include(<sanitizer/common_interface_defs.h>)
+#include <sanitizer/common_interface_defs.h>
+#define FUZZ_HAS_SANITIZER_CALLBACK 1
+#endif
+#endif
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size);
+
+#define FUZZ_DEFAULT_RUNS 10000  // mutated inputs run after the corpus
+#define FUZZ_RANDOM_MAX_SIZE 512 // bytes of a random input, used when there is no corpus
+#define FUZZ_MAX_MUTATIONS 4     // mutations applied to one corpus input
+#define FUZZ_CRASH_FILE "crash-input"
+
+static const char ALPHABET[] = "0123456789ABCDEFabcdef|~#+-!\n"; // characters of the vault format
+
+// Numbers that hit the edges of the size and count fields
+static const char* const INTERESTING_NUMBERS[] = {
+    "0", "1", "255", "256", "65535", "65536", "4294967295", "4294967296",
+    "99999999999999999", "9223372036854775807", "18446744073709551615", "18446744073709551616",
+};
+
+static std::string s_Current; // input being run, saved to FUZZ_CRASH_FILE if it crashes
+
+static void SaveCurrent() {
+    if (std::FILE* file = std::fopen(FUZZ_CRASH_FILE, "wb")) {
+        std::fwrite(s_Current.data(), 1, s_Current.size(), file);
+        std::fclose(file);
+    }
+}
+
+static void OnAbort(int) {
+    SaveCurrent();
+    std::signal(SIGABRT, SIG_DFL);
+    std::abort();
+}
+
+static void Run(const std::string& input) {
+    s_Current = input;
+    LLVMFuzzerTestOneInput(reinterpret_cast<const uint8_t*>(s_Current.data()), s_Current.size());
+}
+
+static std::string ReadInput(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+/**
+ * @class Mutator
+ * @brief Derives new inputs from the corpus with mutations aimed at the line based vault format:
+ * bytes, numbers swapped for edge values, lines spliced in from other inputs, fields dropped.
+ */
+class Mutator {
+public:
+    Mutator(uint64_t seed, const std::vector<std::string>& corpus) : m_Rng(seed), m_Corpus(corpus) {}
+
+    std::string Next() {
+        if (m_Corpus.empty()) return Random();
+        std::string input = m_Corpus[m_Rng() % m_Corpus.size()];
+        for (uint64_t count = 1 + m_Rng() % FUZZ_MAX_MUTATIONS; count-- > 0;) Mutate(input);
+        return input;
+    }
+
+private:
+    std::string Random() {
+        std::string input(m_Rng() % FUZZ_RANDOM_MAX_SIZE, '\0');
+        for (char& c : input) c = m_Rng() % 8 == 0 ? static_cast<char>(m_Rng()) : Letter();
+        return input;
+    }
+
+    char Letter() { return ALPHABET[m_Rng() % (sizeof(ALPHABET) - 1)]; }
+
+    size_t Position(const std::string& input) { return input.empty() ? 0 : m_Rng() % input.size(); }
+
+    // Start and end (past the '\n') of the line holding `pos`
+    static std::pair<size_t, size_t> LineAt(const std::string& input, size_t pos) {
+        size_t start = input.rfind('\n', pos == 0 ? 0 : pos - 1);
+        start = start == std::string::npos || pos == 0 ? 0 : start + 1;
+        size_t end = input.find('\n', pos);
+        return { start, end == std::string::npos ? input.size() : end + 1 };
+    }
+
+    void Mutate(std::string& input) {
+        switch (m_Rng() % 6) {
+        case 0: // overwrite a byte
+            if (!input.empty()) input[Position(input)] = m_Rng() % 2 ? Letter() : static_cast<char>(m_Rng());
+            break;
+        case 1: // insert a byte
+            input.insert(input.begin() + static_cast<std::ptrdiff_t>(Position(input)), Letter());
+            break;
+        case 2: // erase a few bytes
+            if (!input.empty()) {
+                size_t pos = Position(input);
+                input.erase(pos, 1 + m_Rng() % 16);
+            }
+            break;
+        case 3: { // replace a number with an edge value
+            size_t pos = input.find_first_of("0123456789", Position(input));
+            if (pos == std::string::npos) break;
+            size_t end = input.find_first_not_of("0123456789", pos);
+            input.replace(pos, (end == std::string::npos ? input.size() : end) - pos,
+                          INTERESTING_NUMBERS[m_Rng() % std::size(INTERESTING_NUMBERS)]);
+            break;
+        }
+        case 4: { // splice in a line of another input
+            const std::string& other = m_Corpus[m_Rng() % m_Corpus.size()];
+            if (other.empty()) break;
+            auto [start, end] = LineAt(other, Position(other));
+            input.insert(LineAt(input, Position(input)).first, other, start, end - start);
+            break;
+        }
+        case 5: { // drop the last field of a line, e.g. its checksum, or the whole line
+            auto [start, end] = LineAt(input, Position(input));
+            size_t lineEnd = end > start && input[end - 1] == '\n' ? end - 1 : end;
+            size_t delimiter = input.rfind('|', lineEnd == 0 ? 0 : lineEnd - 1);
+            if (m_Rng() % 4 == 0 || delimiter == std::string::npos || delimiter < start) input.erase(start, end - start);
+            else input.erase(delimiter, lineEnd - delimiter);
+            break;
+        }
+        }
+    }
+
+    std::mt19937_64 m_Rng;
+    const std::vector<std::string>& m_Corpus;
+};
+
+/**
+ * @brief Usage: <target> [--seed N] [--runs N] [files or directories...]
+ *
+ * Runs every file given (directories are walked), like a libFuzzer binary replaying a corpus,
+ * then `--runs` inputs (#FUZZ_DEFAULT_RUNS by default) mutated from those files with the given
+ * seed, or random inputs mostly made of the characters of the vault format without files. An
+ * input that crashes the target is saved to #FUZZ_CRASH_FILE, rerunning the same seed and run
+ * count reproduces it as well.
+ */
+int main(int argc, char* argv[]) {
+    uint64_t seed = 1;
+    size_t runs = FUZZ_DEFAULT_RUNS;
+    std::vector<std::string> corpus;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg(argv[i]);
+        if (arg == "--seed" && i + 1 < argc) seed = std::strtoull(argv[++i], nullptr, 10);
+        else if (arg == "--runs" && i + 1 < argc) runs = std::strtoul(argv[++i], nullptr, 10);
+        else if (std::filesystem::is_directory(arg)) {
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(arg)) {
+                if (entry.is_regular_file()) corpus.push_back(ReadInput(entry.path()));
+            }
+        }
+        else corpus.push_back(ReadInput(arg));
+    }
+
+    std::signal(SIGABRT, OnAbort);
+#ifdef FUZZ_HAS_SANITIZER_CALLBACK
+    __sanitizer_set_death_callback(SaveCurrent);
+#endif
+
+    for (const std::string& input : corpus) Run(input);
+
+    Mutator mutator(seed, corpus);
+    for (size_t run = 0; run < runs; ++run) Run(mutator.Next());
+
+    std::cerr << "Ran " << corpus.size() << " corpus input(s) and " << runs << " mutated input(s), seed " << seed << std::endl;
+    return 0;
+}
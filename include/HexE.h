@@ -10,10 +10,10 @@
  * This source code is licensed under the MIT License. For more details, see
  * the LICENSE file in the root directory of this project.
  *
- * Version: v1.0
+ * Version: v1.2.0
  * Author: Ghost
  * Created On: 1-28-2025
- * Last Modified: 1-29-2025
+ * Last Modified: 10-19-2026
  *****************************************************************************/
 
 #pragma once
@@ -27,12 +27,95 @@
  * The `HEXEncryption` class provides an implementation of the `IEncryption` interface, 
  * encoding plaintext strings into a hexadecimal format and decoding them back. This allows 
  * simple, readable obfuscation of stored data while adhering to a structured encryption interface.
+ * 
+ * The class is `final` and its kernels (`EncodeTo`/`DecodeTo`) are defined inline, so code that
+ * knows the concrete type (see `HexStage` and `CustomIO::SaveToFileAs`) calls them without
+ * virtual dispatch and the compiler can inline and vectorize them inside its own loops.
  */
-class HEXEncryption : public IEncryption {
+class HEXEncryption final : public IEncryption {
 public:
     HEXEncryption() = default;
     ~HEXEncryption() override = default;
 
+    /**
+     * @brief Writes 2 hexadecimal digits per input byte into `output`.
+     * 
+     * Branch free (no lookup table), so the loop vectorizes.
+     * 
+     * @param input The bytes to encode.
+     * @param size Number of bytes in `input`.
+     * @param output Buffer receiving `size * 2` characters.
+     */
+    static void EncodeTo(const char* input, size_t size, char* output) {
+        for (size_t i = 0; i < size; ++i) {
+            unsigned char c = static_cast<unsigned char>(input[i]);
+            unsigned char high = c >> 4, low = c & 0x0F;
+            output[2 * i] = static_cast<char>('0' + high + (high > 9) * 7);    // High nibble, 'A' is '0' + 17
+            output[2 * i + 1] = static_cast<char>('0' + low + (low > 9) * 7);  // Low nibble
+        }
+    }
+
+    /**
+     * @brief Checks a single character, branch free.
+     */
+    static bool IsHexDigit(unsigned char c) {
+        return (static_cast<unsigned char>(c - '0') < 10) | (static_cast<unsigned char>((c | 0x20) - 'a') < 6);
+    }
+
+    /**
+     * @brief Writes one byte per pair of hexadecimal digits into `output`.
+     * 
+     * Accepts upper and lower case digits. Validation is folded into the loop (no early exit),
+     * so the loop stays branch free and vectorizes.
+     * 
+     * @param input The hexadecimal digits to decode.
+     * @param size Number of characters in `input`.
+     * @param output Buffer receiving `size / 2` bytes.
+     * @return `false` if `size` is odd or `input` holds a character that is not a hexadecimal digit.
+     */
+    static bool DecodeTo(const char* input, size_t size, char* output) {
+        bool valid = (size % 2) == 0;
+        for (size_t i = 0; i < size / 2; ++i) {
+            unsigned char high = static_cast<unsigned char>(input[2 * i]);
+            unsigned char low = static_cast<unsigned char>(input[2 * i + 1]);
+            valid &= IsHexDigit(high) & IsHexDigit(low);
+            // '0'-'9' keep their low nibble, 'A'-'F'/'a'-'f' have bit 6 set and a low nibble of 1-6, so add 9
+            output[i] = static_cast<char>((((high & 0x0F) + (high >> 6) * 9) << 4) | ((low & 0x0F) + (low >> 6) * 9));
+        }
+        return valid;
+    }
+
+    /**
+     * @brief Batch version of `EncodeTo`, see `IEncryption::encryptBatch` for the layout.
+     * 
+     * Output sizes are known up front, so the arena is sized once and every input is
+     * encoded in place, with no allocation per record.
+     */
+    template <typename Out>
+    static void EncodeBatchTo(const std::string_view* inputs, size_t count, Out& arena, std::vector<size_t>& offsets) {
+        offsets.resize(count + 1);
+        offsets[0] = 0;
+        for (size_t i = 0; i < count; ++i) offsets[i + 1] = offsets[i] + inputs[i].size() * 2;
+        arena.resize(offsets[count]);
+        for (size_t i = 0; i < count; ++i) EncodeTo(inputs[i].data(), inputs[i].size(), &arena[offsets[i]]);
+    }
+
+    /**
+     * @brief Batch version of `DecodeTo`, see `IEncryption::decryptBatch` for the layout.
+     * 
+     * @return `false` if any input was rejected by `DecodeTo`.
+     */
+    template <typename Out>
+    static bool DecodeBatchTo(const std::string_view* inputs, size_t count, Out& arena, std::vector<size_t>& offsets) {
+        bool valid = true;
+        offsets.resize(count + 1);
+        offsets[0] = 0;
+        for (size_t i = 0; i < count; ++i) offsets[i + 1] = offsets[i] + inputs[i].size() / 2;
+        arena.resize(offsets[count]);
+        for (size_t i = 0; i < count; ++i) valid &= DecodeTo(inputs[i].data(), inputs[i].size(), &arena[offsets[i]]);
+        return valid;
+    }
+
     /**
      * @brief Encrypts a given string by converting it to a hexadecimal representation.
      * 
@@ -47,9 +130,39 @@ public:
      * @brief Decrypts a hexadecimal-encoded string back to its original form.
      * 
      * The function expects a valid hex-encoded string where each pair of hex digits represents a character.
+     * It decodes through `decryptSecure`, so only the returned string holds the plaintext in regular
+     * memory; the vault never calls it, secrets go through `decryptSecure` and `decryptBatch`.
      * 
      * @param input The hexadecimal string to be decrypted.
-     * @return The original plaintext string.
+     * @return The original plaintext string, or an empty string if `input` has an odd length
+     *         or holds a character that is not a hexadecimal digit.
      */
     std::string decrypt(const std::string& input) const override;
+
+    /**
+     * @brief Encrypts a secret held in secure memory without copying it.
+     * 
+     * @param input The plaintext secret to be encrypted.
+     * @return A hexadecimal-encoded string.
+     */
+    std::string encryptSecure(const SecureString& input) const override;
+
+    /**
+     * @brief Decodes a hexadecimal-encoded string directly into secure memory.
+     * 
+     * @param input The hexadecimal string to be decrypted.
+     * @param output Receives the original plaintext.
+     * @return `false` if `input` is not valid hexadecimal (odd length or a non-hex character).
+     */
+    bool decryptSecure(const std::string& input, SecureString& output) const override;
+
+    /**
+     * @brief Hex encodes a batch of inputs into one arena (see `EncodeBatchTo`).
+     */
+    void encryptBatch(const std::string_view* inputs, size_t count, std::string& arena, std::vector<size_t>& offsets) const override;
+
+    /**
+     * @brief Hex decodes a batch of inputs into one secure arena (see `DecodeBatchTo`).
+     */
+    bool decryptBatch(const std::string_view* inputs, size_t count, SecureString& arena, std::vector<size_t>& offsets) const override;
 };
@@ -9,14 +9,17 @@
  * This source code is licensed under the MIT License. For more details, see
  * the LICENSE file in the root directory of this project.
  *
- * Version: v1.0
+ * Version: v1.2.0
  * Author: Ghost
  * Created On: 1-28-2025
- * Last Modified: 1-29-2025
+ * Last Modified: 10-19-2026
  *****************************************************************************/
 
 #pragma once
+#include "secure_allocator.h"
 #include <string>
+#include <string_view>
+#include <vector>
 
 /**
  * @class IEncryption
@@ -49,6 +52,89 @@ public:
      */
     virtual std::string decrypt(const std::string& input) const = 0;
 
+    /**
+     * @brief Encrypts a secret held in secure memory.
+     * 
+     * The default implementation copies the secret into a temporary string for `encrypt`
+     * and wipes that copy afterwards. Derived classes should override it to read the
+     * secret directly.
+     * 
+     * @param input The plaintext secret to be encrypted.
+     * @return The encrypted string.
+     */
+    virtual std::string encryptSecure(const SecureString& input) const {
+        std::string plain(input.data(), input.size());
+        std::string encrypted = encrypt(plain);
+        SecurePool::Wipe(plain);
+        return encrypted;
+    }
+
+    /**
+     * @brief Decrypts the given input string straight into secure memory.
+     * 
+     * The default implementation decrypts with `decrypt` and wipes the temporary
+     * plaintext after copying it. Derived classes should override it to write the
+     * plaintext directly into `output`.
+     * 
+     * @param input The encrypted string to be decrypted.
+     * @param output Receives the decrypted secret (it is overwritten).
+     * @return `false` if the module rejected `input` as malformed. The default
+     *         implementation cannot tell and always returns `true`.
+     */
+    virtual bool decryptSecure(const std::string& input, SecureString& output) const {
+        std::string plain = decrypt(input);
+        output.assign(plain.data(), plain.size());
+        SecurePool::Wipe(plain);
+        return true;
+    }
+
+    /**
+     * @brief Encrypts many inputs with one call.
+     * 
+     * All outputs are written back to back into `arena`, output `i` is
+     * `arena[offsets[i], offsets[i + 1])`. A batch lets a module amortize its setup cost
+     * and process independent records together. The default implementation loops over
+     * `encryptSecure`.
+     * 
+     * @param inputs The plaintexts to encrypt.
+     * @param count Number of entries in `inputs`.
+     * @param arena Receives every encrypted output (it is overwritten).
+     * @param offsets Receives `count + 1` offsets into `arena`.
+     */
+    virtual void encryptBatch(const std::string_view* inputs, size_t count, std::string& arena, std::vector<size_t>& offsets) const {
+        arena.clear();
+        offsets.assign(1, 0);
+        for (size_t i = 0; i < count; ++i) {
+            arena.append(encryptSecure(SecureString(inputs[i].data(), inputs[i].size())));
+            offsets.push_back(arena.size());
+        }
+    }
+
+    /**
+     * @brief Decrypts many inputs with one call, straight into secure memory.
+     * 
+     * Same layout as `encryptBatch`. The default implementation loops over `decryptSecure`.
+     * 
+     * @param inputs The encrypted strings to decrypt.
+     * @param count Number of entries in `inputs`.
+     * @param arena Receives every decrypted output (it is overwritten).
+     * @param offsets Receives `count + 1` offsets into `arena`.
+     * @return `false` if any input was rejected, the layout is still complete so the
+     *         caller can find the bad inputs one by one.
+     */
+    virtual bool decryptBatch(const std::string_view* inputs, size_t count, SecureString& arena, std::vector<size_t>& offsets) const {
+        bool valid = true;
+        SecureString plain;
+        arena.clear();
+        offsets.assign(1, 0);
+        for (size_t i = 0; i < count; ++i) {
+            valid &= decryptSecure(std::string(inputs[i]), plain);
+            arena.append(plain);
+            offsets.push_back(arena.size());
+        }
+        return valid;
+    }
+
     /**
      * @brief Virtual destructor for the interface.
      * 
@@ -0,0 +1,92 @@
+/******************************************************************************
+ * Project: Password Manager - Console App
+ * File: bk_tree.h
+ * Description:
+ *   A Burkhard-Keller tree over app names, used to suggest the closest names
+ *   when a lookup does not match exactly ("did you mean").
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.2.0
+ * Author: Ghost
+ * Created On: 10-19-2026
+ * Last Modified: 10-19-2026
+ *****************************************************************************/
+
+#pragma once
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @class BKTree
+ * @brief An index of words that finds every word within a given edit distance of a query.
+ *
+ * Every child of a node is stored together with its distance to that node. Thanks to the
+ * triangle inequality a search for words within distance `k` of a query only needs to
+ * descend into children whose distance lies in `[d - k, d + k]`, where `d` is the distance
+ * between the query and the node, so most of the tree is never visited.
+ *
+ * Distances are case-insensitive Levenshtein distances (insert, delete, substitute).
+ * Removal marks a node as deleted, the tree is rebuilt once deleted nodes outnumber live ones.
+ */
+class BKTree {
+public:
+    /**
+     * @brief Adds a word to the tree. Adding a word that is already present does nothing.
+     */
+    void Insert(const std::string& word);
+
+    /**
+     * @brief Removes a word from the tree.
+     *
+     * @return `true` if the word was present, `false` otherwise.
+     */
+    bool Remove(const std::string& word);
+
+    /**
+     * @brief Finds the words closest to `query`.
+     *
+     * @param query The (possibly misspelled) word to look for.
+     * @param maxDistance The largest edit distance a match may have.
+     * @param maxResults The maximum number of matches returned.
+     * @return Matches ordered by distance (closest first), then alphabetically.
+     */
+    std::vector<std::string> Search(const std::string& query, uint32_t maxDistance, size_t maxResults) const;
+
+    /**
+     * @brief Computes the case-insensitive Levenshtein distance between two words.
+     */
+    static uint32_t Distance(const std::string& a, const std::string& b);
+
+private:
+    /**
+     * @brief A tree node. Children form a singly linked list through `nextSibling`.
+     */
+    struct Node {
+        std::string word;
+        uint32_t distanceToParent;
+        uint32_t firstChild;
+        uint32_t nextSibling;
+        bool deleted;
+    };
+
+    /**
+     * @brief Finds the node holding `word`, or #NO_NODE.
+     */
+    uint32_t FindNode(const std::string& word) const;
+
+    /**
+     * @brief Rebuilds the tree from its live words, dropping deleted nodes.
+     */
+    void Rebuild();
+
+    static constexpr uint32_t NO_NODE = UINT32_MAX;
+
+    std::vector<Node> m_Nodes; // m_Nodes[0] is the root
+    size_t m_DeletedCount = 0;
+};
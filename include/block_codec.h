@@ -0,0 +1,71 @@
+/******************************************************************************
+ * Project: Password Manager - Console App
+ * File: block_codec.h
+ * Description:
+ *   A small LZ77 style block compressor used to shrink vault files before
+ *   they are encrypted and written to disk.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.2.0
+ * Author: Ghost
+ * Created On: 10-19-2026
+ * Last Modified: 10-19-2026
+ *****************************************************************************/
+
+#pragma once
+#include <cstddef>
+
+/**
+ * @class BlockCodec
+ * @brief A fast, dependency free block compressor in the spirit of LZ4.
+ *
+ * Each block is compressed on its own, so blocks can be decompressed in any order
+ * (and on any thread). The format is a sequence of tokens, each holding a run of
+ * literal bytes followed by a back-reference (offset + length) into the bytes
+ * already produced. The final sequence only holds literals.
+ *
+ * The decoder is fully bounds checked, a corrupt block is reported instead of
+ * reading or writing outside of its buffers.
+ */
+class BlockCodec {
+public:
+    /**
+     * @brief Returns the largest size `Compress` can produce for `size` input bytes.
+     */
+    static size_t MaxCompressedSize(size_t size);
+
+    /**
+     * @brief Returns the largest size a valid block of `size` compressed bytes can decompress to.
+     *
+     * Used to reject a stored original size before allocating for it.
+     */
+    static size_t MaxDecompressedSize(size_t size);
+
+    /**
+     * @brief Compresses a block of bytes.
+     *
+     * The caller owns the output buffer, so blocks holding secrets can be compressed
+     * straight into secure memory.
+     *
+     * @param src Pointer to the bytes to compress.
+     * @param size Number of bytes in `src`.
+     * @param dst Buffer that receives the compressed block, must hold `MaxCompressedSize(size)` bytes.
+     * @return The number of bytes written to `dst`.
+     */
+    static size_t Compress(const char* src, size_t size, char* dst);
+
+    /**
+     * @brief Decompresses a block produced by `Compress`.
+     *
+     * @param src Pointer to the compressed block.
+     * @param size Number of bytes in `src`.
+     * @param dst Buffer that receives the original bytes, must hold `rawSize` bytes.
+     * @param rawSize The exact size of the original block.
+     * @return `true` if the block was valid and produced exactly `rawSize` bytes, `false` otherwise.
+     */
+    static bool Decompress(const char* src, size_t size, char* dst, size_t rawSize);
+};
@@ -0,0 +1,64 @@
+/******************************************************************************
+ * Project: Password Manager - Console App
+ * File: checksum.h
+ * Description:
+ *   CRC32C checksums used to detect damaged lines in vault files, with the
+ *   hardware CRC instruction when the CPU has one.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.2.0
+ * Author: Ghost
+ * Created On: 10-19-2026
+ * Last Modified: 10-19-2026
+ *****************************************************************************/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#define CHECKSUM_DIGITS 8 // a checksum is written as 8 hexadecimal digits
+
+/**
+ * @class Checksum
+ * @brief CRC32C (Castagnoli) checksums.
+ *
+ * The implementation is picked once, at the first call:
+ * - x86-64 with SSE4.2: the `crc32` instruction, 8 bytes per step.
+ * - ARMv8 built with the CRC extension: the `crc32cx` instruction.
+ * - Anything else: a table driven "slicing by 8" version.
+ *
+ * All of them produce the same values, so a vault written on one machine checks out on any other.
+ */
+class Checksum {
+public:
+    /**
+     * @brief Computes the CRC32C of a buffer.
+     *
+     * @param data The bytes to checksum.
+     * @param size Number of bytes in `data`.
+     * @param crc A previous result to continue from, to checksum data given in pieces.
+     * @return The checksum.
+     */
+    static uint32_t Crc32c(const char* data, size_t size, uint32_t crc = 0);
+
+    /**
+     * @brief Tells whether `Crc32c` runs on the hardware instruction.
+     */
+    static bool HasHardwareSupport();
+
+    /**
+     * @brief Writes a checksum as #CHECKSUM_DIGITS uppercase hexadecimal digits.
+     */
+    static void Format(uint32_t crc, char* output);
+
+    /**
+     * @brief Reads a checksum written by `Format`.
+     *
+     * @return `false` if `input` is not exactly #CHECKSUM_DIGITS hexadecimal digits.
+     */
+    static bool Parse(const char* input, size_t size, uint32_t& crc);
+};
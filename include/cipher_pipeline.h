@@ -0,0 +1,200 @@
+/******************************************************************************
+ * Project: Password Manager - Console App
+ * File: cipher_pipeline.h
+ * Description:
+ *   Compile-time codec stages (compression, hex, any IEncryption) and a
+ *   pipeline that chains them without intermediate strings.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.2.0
+ * Author: Ghost
+ * Created On: 10-19-2026
+ * Last Modified: 10-19-2026
+ *****************************************************************************/
+
+#pragma once
+#include "IEncryption.h"
+#include "HexE.h"
+#include "block_codec.h"
+#include "secure_allocator.h"
+#include <array>
+#include <tuple>
+
+/*
+ * A stage is any type providing these two const member templates, where `Out` is a
+ * `std::string` or `SecureString` the stage **appends** to:
+ *
+ *     template <typename Out> void Encode(const char* input, size_t size, Out& out) const;
+ *     template <typename Out> bool Decode(const char* input, size_t size, Out& out) const;
+ *
+ * Encryption stages (the ones returned by `MakeStage`) also provide batch versions with
+ * the layout of `IEncryption::encryptBatch`, used by the record loops in `CustomIO`:
+ *
+ *     void EncodeBatch(const std::string_view* inputs, size_t count, std::string& arena, std::vector<size_t>& offsets) const;
+ *     bool DecodeBatch(const std::string_view* inputs, size_t count, SecureString& arena, std::vector<size_t>& offsets) const;
+ *
+ * Stages are plain value types, so a pipeline built from them is fully known at compile
+ * time and the compiler can inline every stage into the loop that drives it.
+ */
+
+/**
+ * @struct HexStage
+ * @brief Hex encoding through the inline `HEXEncryption` kernels, no virtual calls.
+ */
+struct HexStage {
+    template <typename Out>
+    void Encode(const char* input, size_t size, Out& out) const {
+        size_t start = out.size();
+        out.resize(start + size * 2);
+        HEXEncryption::EncodeTo(input, size, &out[start]);
+    }
+
+    template <typename Out>
+    bool Decode(const char* input, size_t size, Out& out) const {
+        size_t start = out.size();
+        out.resize(start + size / 2);
+        return HEXEncryption::DecodeTo(input, size, &out[start]);
+    }
+
+    void EncodeBatch(const std::string_view* inputs, size_t count, std::string& arena, std::vector<size_t>& offsets) const {
+        HEXEncryption::EncodeBatchTo(inputs, count, arena, offsets);
+    }
+
+    bool DecodeBatch(const std::string_view* inputs, size_t count, SecureString& arena, std::vector<size_t>& offsets) const {
+        return HEXEncryption::DecodeBatchTo(inputs, count, arena, offsets);
+    }
+};
+
+/**
+ * @struct CompressStage
+ * @brief Block compression through `BlockCodec`.
+ *
+ * The compressed format does not store the original size, so a stage used for decoding
+ * must be given it (`rawSize`). A size the input cannot decompress to is rejected before
+ * anything is allocated, since it comes from the file.
+ */
+struct CompressStage {
+    size_t rawSize = 0;
+
+    template <typename Out>
+    void Encode(const char* input, size_t size, Out& out) const {
+        size_t start = out.size();
+        out.resize(start + BlockCodec::MaxCompressedSize(size));
+        out.resize(start + BlockCodec::Compress(input, size, &out[start]));
+    }
+
+    template <typename Out>
+    bool Decode(const char* input, size_t size, Out& out) const {
+        if (rawSize > BlockCodec::MaxDecompressedSize(size)) return false;
+        size_t start = out.size();
+        out.resize(start + rawSize);
+        return BlockCodec::Decompress(input, size, &out[start], rawSize);
+    }
+};
+
+/**
+ * @struct EncryptionStage
+ * @brief Runtime fallback stage wrapping any `IEncryption` through its virtual interface.
+ *
+ * Unlike the other stages this one goes through temporary strings, since an arbitrary
+ * encryption module only works on whole strings.
+ */
+struct EncryptionStage {
+    const IEncryption& encryption;
+
+    template <typename Out>
+    void Encode(const char* input, size_t size, Out& out) const {
+        out.append(encryption.encryptSecure(SecureString(input, size)));
+    }
+
+    template <typename Out>
+    bool Decode(const char* input, size_t size, Out& out) const {
+        SecureString plain;
+        if (!encryption.decryptSecure(std::string(input, size), plain)) return false;
+        out.append(plain.data(), plain.size());
+        return true;
+    }
+
+    void EncodeBatch(const std::string_view* inputs, size_t count, std::string& arena, std::vector<size_t>& offsets) const {
+        encryption.encryptBatch(inputs, count, arena, offsets); // one virtual call per batch
+    }
+
+    bool DecodeBatch(const std::string_view* inputs, size_t count, SecureString& arena, std::vector<size_t>& offsets) const {
+        return encryption.decryptBatch(inputs, count, arena, offsets);
+    }
+};
+
+/**
+ * @brief Picks the stage for an encryption type: the inline one when the type is known, the virtual fallback otherwise.
+ */
+inline HexStage MakeStage(const HEXEncryption&) { return {}; }
+inline EncryptionStage MakeStage(const IEncryption& encryption) { return { encryption }; }
+
+/**
+ * @class CipherPipeline
+ * @brief Chains stages, e.g. `CipherPipeline<CompressStage, HexStage>` for compress -> encrypt/encode.
+ *
+ * `Encode` runs the stages first to last and `Decode` runs them last to first. Each stage
+ * but the final one writes into a scratch buffer owned by the pipeline; the buffers keep
+ * their capacity between calls, so a warm pipeline allocates nothing. Scratch buffers are
+ * `SecureString`s since they hold plaintext.
+ *
+ * @note A pipeline is not thread safe because of its scratch buffers, use one per thread.
+ */
+template <typename... Stages>
+class CipherPipeline {
+public:
+    explicit CipherPipeline(Stages... stages) : m_Stages(std::move(stages)...) {}
+
+    /**
+     * @brief Runs every stage on `input` and appends the final output to `out`.
+     */
+    template <typename Out>
+    void Encode(const char* input, size_t size, Out& out) const {
+        EncodeFrom<0>(input, size, out);
+    }
+
+    /**
+     * @brief Reverses every stage on `input` and appends the original data to `out`.
+     *
+     * @return `false` if any stage rejected its input.
+     */
+    template <typename Out>
+    bool Decode(const char* input, size_t size, Out& out) const {
+        return DecodeFrom<sizeof...(Stages) - 1>(input, size, out);
+    }
+
+private:
+    template <size_t I, typename Out>
+    void EncodeFrom(const char* input, size_t size, Out& out) const {
+        if constexpr (I + 1 == sizeof...(Stages)) {
+            std::get<I>(m_Stages).Encode(input, size, out);
+        }
+        else {
+            SecureString& scratch = m_Scratch[I];
+            scratch.clear();
+            std::get<I>(m_Stages).Encode(input, size, scratch);
+            EncodeFrom<I + 1>(scratch.data(), scratch.size(), out);
+        }
+    }
+
+    template <size_t I, typename Out>
+    bool DecodeFrom(const char* input, size_t size, Out& out) const {
+        if constexpr (I == 0) {
+            return std::get<0>(m_Stages).Decode(input, size, out);
+        }
+        else {
+            SecureString& scratch = m_Scratch[I];
+            scratch.clear();
+            if (!std::get<I>(m_Stages).Decode(input, size, scratch)) return false;
+            return DecodeFrom<I - 1>(scratch.data(), scratch.size(), out);
+        }
+    }
+
+    std::tuple<Stages...> m_Stages;
+    mutable std::array<SecureString, sizeof...(Stages)> m_Scratch;
+};
@@ -9,19 +9,75 @@
  * This source code is licensed under the MIT License. For more details, see
  * the LICENSE file in the root directory of this project.
  *
- * Version: v1.1.0
+ * Version: v1.2.0
  * Author: Ghost
  * Created On: 1-28-2025
- * Last Modified: 02-06-2025
+ * Last Modified: 10-19-2026
  *****************************************************************************/
 
 #pragma once
 #include "../include/IEncryption.h"
+#include "../include/entry_metadata.h"
+#include "../include/secure_allocator.h"
+#include <cstdint>
 #include <iostream>
 #include <filesystem>
+#include <functional>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
 
 #define FIO_EXT ".pwdb"
+#define FIO_BLOCK_TAG '~'            // first character of a compressed block line
+#define FIO_BLOCK_SIZE (64 * 1024)   // plaintext bytes gathered into one compressed block
+#define FIO_META_TAG '#'             // first character of the line holding the entry metadata
+#define FIO_REMOVE_TAG '-'           // first character of an appended line removing an entry
+#define FIO_META_PATCH_TAG '+'       // first character of an appended line holding the metadata rows of changed entries
+#define FIO_JOURNAL_MAX_RATIO 4      // appended changes may grow the vault up to 1/N of its written size before it is rewritten
+#define FIO_FORMAT_LINE "!crc32c"    // first line of a vault whose every line must end with a checksum
+
+/**
+ * @struct VaultDamage
+ * @brief One damaged line of a vault file, as found by `CustomIO::VerifyFile`.
+ */
+struct VaultDamage {
+    size_t line;        // 1-based line number
+    uint64_t offset;    // byte offset of the line in the file
+    size_t records;     // records lost with the line: 1 for a record line, the block size for a compressed block, 0 if unknown
+    bool metadata;      // the line holds entry metadata (see FIO_META_TAG, FIO_META_PATCH_TAG), no password is lost with it
+    const char* reason; // short description, e.g. "checksum mismatch"
+};
+
+/**
+ * @struct VerifyReport
+ * @brief Result of `CustomIO::VerifyFile`.
+ */
+struct VerifyReport {
+    size_t lines = 0;                 // non-empty lines checked
+    size_t unchecked = 0;             // lines written before checksums existed, only their layout could be checked
+    bool checksummed = false;         // the vault starts with #FIO_FORMAT_LINE, a line without checksum is damaged
+    std::vector<VaultDamage> damaged; // damaged lines, in file order
+};
+
+/**
+ * @struct EncryptedRecord
+ * @brief One record of a vault file as it is stored, seen by `CustomIO::ScanFile`.
+ */
+struct EncryptedRecord {
+    std::string_view app;      // encrypted name
+    std::string_view password; // encrypted password
+    uint64_t offset;           // byte offset of the line holding the record
+    bool removed;              // an appended removal (see #FIO_REMOVE_TAG), `password` is empty
+};
+
+/**
+ * @struct VaultChange
+ * @brief One entry changed since a vault was last written, handed to `CustomIO::AppendChanges`.
+ */
+struct VaultChange {
+    std::string_view app;
+    const SecureString* password; // the new password, `nullptr` if the entry was removed
+};
 
 /**
  * @class CustomIO
@@ -106,26 +162,206 @@ public:
      */
     static std::filesystem::path GetSavePath(const std::string& filename);
 
+    /**
+     * @brief Returns the path of the key-hash index that belongs to a vault file.
+     * 
+     * The index sits next to the vault and uses the #FIO_INDEX_EXT extension.
+     * 
+     * @param savePath The path of the vault file.
+     * @return The path of its index file.
+     */
+    static std::filesystem::path GetIndexPath(const std::filesystem::path& savePath);
+
     /**
      * @brief Saves a map of key-value pairs to a file, encrypting each key and value.
      * 
+     * Every line ends with a CRC32C checksum of the line (`|` and #CHECKSUM_DIGITS hexadecimal
+     * digits), checked by `LoadFromFile`, `FindInFile` and `VerifyFile`. The file starts with
+     * the #FIO_FORMAT_LINE line, so a line that lost its checksum is not mistaken for one saved
+     * before checksums existed.
+     * 
+     * When `compress` is `true` the records are gathered into blocks of about #FIO_BLOCK_SIZE
+     * bytes, each block is compressed with `BlockCodec` and then encrypted as a whole. Every
+     * block is written on its own line starting with #FIO_BLOCK_TAG, so blocks can be
+     * decompressed independently (and in parallel) by `LoadFromFile`.
+     * 
+     * A key-hash index (see `VaultIndex`) is written next to the vault so `FindInFile` can
+     * answer single lookups without loading the whole file.
+     * 
      * @param passwords The map containing key-value pairs (e.g., app names and passwords).
      * @param savePath The path to the file where data will be saved.
      * @param key The encryption key used to encrypt the data.
+     * @param compress If `true`, store the records as compressed blocks instead of one line per record.
+     * @param metadata Entry metadata saved with the records, on one #FIO_META_TAG line at the end of the
+     *                 file (columnar, compressed, then encrypted). `nullptr` to save none.
+     * 
+     * @note This is the runtime entry point: it forwards to `SaveToFileAs<HEXEncryption>` when
+     *       `encrypt` is a `HEXEncryption` and to the virtual `SaveToFileAs<IEncryption>` otherwise.
+     */
+    static bool SaveToFile(const PasswordMap& passwords, const std::filesystem::path& savePath, const IEncryption& encrypt, bool compress = false, const EntryMetadata* metadata = nullptr);
+
+    /**
+     * @brief Compile-time specialized version of `SaveToFile`.
+     * 
+     * The record loop is instantiated for the concrete encryption type, whose codec stage (see
+     * `MakeStage` in cipher_pipeline.h) encodes every field straight into one output buffer,
+     * so the codec is inlined into the loop. Compressed blocks go through a
+     * `CipherPipeline<CompressStage, ...>` without intermediate strings.
+     * 
+     * Instantiated for `HEXEncryption` and, as the virtual fallback, `IEncryption`.
      */
-    static bool SaveToFile(const std::unordered_map<std::string, std::string>& passwords, const std::filesystem::path& savePath, const IEncryption& encrypt);
+    template <typename Encryption>
+    static bool SaveToFileAs(const PasswordMap& passwords, const std::filesystem::path& savePath, const Encryption& encrypt, bool compress = false, const EntryMetadata* metadata = nullptr);
+
+    /**
+     * @brief Appends changed entries to a vault instead of writing it again.
+     * 
+     * A changed entry is appended as a record line, which replaces the earlier one when the vault
+     * is loaded, and a removed entry as a #FIO_REMOVE_TAG line. The metadata rows of the changed
+     * entries follow on one #FIO_META_PATCH_TAG line, which replaces those rows when the vault is
+     * loaded, so the appended size follows the change and not the vault. The index is left as it is: it still
+     * describes the part of the file written by `SaveToFile`, and `FindInFile` reads the appended
+     * part after it.
+     * 
+     * Nothing is written, and `false` returned, when the vault should be written in full instead:
+     * it has no valid index, the vault changed after its index (see `VaultIndex::IsCurrent`),
+     * its last line is incomplete, or the appended part would exceed
+     * 1/#FIO_JOURNAL_MAX_RATIO of the indexed part. A full write drops the appended lines, along
+     * with the replaced and removed passwords (and earlier history rows) they leave in the file.
+     * 
+     * @param savePath The path of the vault file.
+     * @param changes The changed entries.
+     * @param encrypt The encryption module the vault was written with.
+     * @param metadata The entry metadata of the whole vault, the rows of the changed entries are
+     *                 appended. `nullptr` to leave the metadata as it is.
+     * @return `true` if the changes were appended.
+     */
+    static bool AppendChanges(const std::filesystem::path& savePath, const std::vector<VaultChange>& changes, const IEncryption& encrypt, const EntryMetadata* metadata = nullptr);
 
     /**
      * @brief Loads decrypted key-value pairs from a file into the provided map.
      * 
      * Reads an encrypted file, decrypts each key-value pair, and stores them in the given 
-     * unordered map.
+     * unordered map. Passwords are decrypted straight into secure memory (see `SecurePool`).
+     * Both plain record lines and compressed blocks are accepted, compressed
+     * blocks are decrypted and decompressed on multiple threads.
+     * 
+     * Lines are applied in file order, so changes appended by `AppendChanges` replace or remove
+     * the entries written before them.
+     * 
+     * Damaged lines (bad checksum, missing delimiter, input the encryption module rejects)
+     * are skipped and counted in a warning, `VerifyFile` tells exactly which ones they are.
+     * 
+     * @note The `decrypt` function of `encrypt` may be called from several threads at once.
      * 
      * @param savePath The path to the file from which data will be loaded. The file extension 
      *                 is automatically corrected if necessary.
      * @param encrypt A reference to the encryption instance used to decrypt data.
-     * @param passwords A reference to the map where decrypted key-value pairs will be stored.
+     * @param metadata Receives the entry metadata of the vault if not `nullptr` (empty if the file has none).
+     * @return The decrypted key-value pairs.
+     */
+    static PasswordMap LoadFromFile(const std::filesystem::path& filename, const IEncryption& encrypt, EntryMetadata* metadata = nullptr);
+
+    /**
+     * @brief Reads the raw (still encrypted) contents of a vault file.
+     * 
+     * This is the I/O half of `LoadFromFile`. It does not decrypt anything, so it is safe
+     * to run before the user has been authenticated, e.g. on a background thread while
+     * the master password prompt is shown.
+     * 
+     * @param savePath The path of the vault file.
+     * @return The file contents, empty if the file does not exist.
+     */
+    static std::string ReadFile(const std::filesystem::path& savePath);
+
+    /**
+     * @brief Decrypts the contents of a vault file read with `ReadFile`.
+     * 
+     * This is the decryption half of `LoadFromFile`.
+     * 
+     * @param contents The raw file contents.
+     * @param encrypt A reference to the encryption instance used to decrypt data.
+     * @param metadata Receives the entry metadata of the vault if not `nullptr`.
+     * @return The decrypted key-value pairs.
+     */
+    static PasswordMap ParseVault(const std::string& contents, const IEncryption& encrypt, EntryMetadata* metadata = nullptr);
+
+    /**
+     * @brief Compile-time specialized version of `ParseVault` (see `SaveToFileAs`).
+     * 
+     * Instantiated for `HEXEncryption` and, as the virtual fallback, `IEncryption`.
+     */
+    template <typename Encryption>
+    static PasswordMap ParseVaultAs(const std::string& contents, const Encryption& encrypt, EntryMetadata* metadata = nullptr);
+
+    /**
+     * @brief Looks up a single entry in a vault file without loading the whole vault.
+     * 
+     * The key-hash index written by `SaveToFile` is consulted first: its Bloom filter answers
+     * "not present" with a single small read, otherwise only the line (or compressed block)
+     * holding the entry is read and decrypted. Changes appended after the indexed part (see
+     * `AppendChanges`) are then read in order and override the indexed entry. A name stored
+     * more than once resolves to its last occurrence, as with `LoadFromFile`. If the index is
+     * missing or out of date, the function falls back to a full `LoadFromFile`, and so does a
+     * "not present" answer from an index older than the vault file (see `VaultIndex::IsCurrent`).
+     * 
+     * @param savePath The path of the vault file.
+     * @param app The application or website name to look up.
+     * @param encrypt A reference to the encryption instance used to decrypt data.
+     * @param pass Receives the password if the entry is found.
+     * @return `true` if the entry exists, `false` otherwise.
+     */
+    static bool FindInFile(const std::filesystem::path& savePath, const std::string& app, const IEncryption& encrypt, SecureString& pass);
+
+    /**
+     * @brief Streams the records of a vault file without loading it, one line in memory at a time.
+     * 
+     * Record lines are handed to `visit` as they are stored, nothing is decrypted, and so are
+     * appended removals. Records of
+     * compressed blocks are decrypted and encrypted again field by field, so every record is
+     * seen the same way whatever the format. Damaged lines are skipped.
+     * 
+     * @param savePath The path of the vault file.
+     * @param encrypt The encryption module the vault was written with.
+     * @param visit Called for every record, the views are only valid during the call. Empty to only read the metadata.
+     * @param metadata Receives the entry metadata of the vault if not `nullptr`, with appended rows and
+     *                removals applied.
+     * @param damaged Receives the number of damaged lines if not `nullptr` (only the lines that were read
+     *                when `visit` is empty).
+     * @return `false` if the file could not be opened.
+     */
+    static bool ScanFile(const std::filesystem::path& savePath, const IEncryption& encrypt, const std::function<void(const EncryptedRecord&)>& visit,
+        EntryMetadata* metadata = nullptr, size_t* damaged = nullptr);
+
+    /**
+     * @brief Appends the #FIO_FORMAT_LINE line to `out`, the first line of a vault written in full.
+     */
+    static void AppendFormatLine(std::string& out);
+
+    /**
+     * @brief Appends a record line, `<encryptedApp>|<encryptedPass>|<checksum>` and a line break, to `out`.
+     */
+    static void AppendRecordLine(std::string& out, std::string_view encryptedApp, std::string_view encryptedPass);
+
+    /**
+     * @brief Appends the line holding `metadata` (compressed, then encrypted) to `out`.
+     *
+     * @param tag #FIO_META_TAG for the whole table, #FIO_META_PATCH_TAG for rows that replace
+     *            the rows of the same names read before them.
+     */
+    static void AppendMetadataLine(std::string& out, const EntryMetadata& metadata, const IEncryption& encrypt, char tag = FIO_META_TAG);
+
+    /**
+     * @brief Checks every line of a vault file against its checksum, without decrypting anything.
+     * 
+     * The file is split into one range per hardware thread and the ranges are checked in
+     * parallel, so a large vault is verified at close to memory speed. No master password is
+     * needed since nothing is decrypted.
+     * 
+     * @param savePath The path of the vault file.
+     * @param report Receives the line counts and every damaged line.
+     * @return `false` if the file could not be read, `true` otherwise (even if lines are damaged).
      */
-    static std::unordered_map<std::string, std::string> LoadFromFile(const std::filesystem::path& filename, const IEncryption& encrypt);
+    static bool VerifyFile(const std::filesystem::path& savePath, VerifyReport& report);
 
 };
@@ -9,10 +9,10 @@
  * This source code is licensed under the MIT License. For more details, see
  * the LICENSE file in the root directory of this project.
  *
- * Version: v1.0
+ * Version: v1.2.0
  * Author: Ghost
  * Created On: 1-28-2025
- * Last Modified: 1-29-2025
+ * Last Modified: 10-19-2026
  *****************************************************************************/
 
 #pragma once
@@ -45,7 +45,7 @@ public:
      * @brief Prints all messages in the buffer and then clears the buffer.
      * 
      * Each message in the buffer is printed in the order it was added.
-     * After printing, the buffer is cleared.
+     * After printing, every message is wiped (they may hold passwords) and the buffer is cleared.
      */
     static void PrintAndClearBuffer();
 
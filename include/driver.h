@@ -9,10 +9,10 @@
  * This source code is licensed under the MIT License. For more details, see
  * the LICENSE file in the root directory of this project.
  *
- * Version: v1.1.0
+ * Version: v1.2.0
  * Author: Ghost
  * Created On: 02-06-2025
- * Last Modified: 02-06-2025
+ * Last Modified: 10-19-2026
  *****************************************************************************/
 
 #pragma once
@@ -21,8 +21,10 @@
  * @brief Runs the main loop of the password manager.
  * 
  * This function handles the program's execution, including:
- * - Loading stored passwords from a file.
- * - Prompting the user for authentication (if not in debug mode).
+ * - Reading the encrypted password file on a detached background thread while the
+ *   user is prompted for authentication (if not in debug mode).
+ * - Decrypting the stored passwords once the user is authenticated. A failed login
+ *   returns without waiting for the read to finish.
  * - Displaying the main menu and processing user input.
  * - Managing password addition, deletion, and viewing.
  * - Writing updated password data back to the file before exiting.
@@ -30,7 +32,71 @@
  * The function maintains a loop where the user can interact with 
  * the password manager until they choose to exit.
  * 
+ * Other vaults can be opened from the menu by name or path. They stay unlocked
+ * in a `VaultCache`, so switching back to one does not reload it, and every
+ * open vault with changes is committed on exit.
+ * 
+ * @param adminPassword The master password.
+ * @param vault The vault opened at startup, a name or a path (see `VaultCache::ResolvePath`).
+ * @param showTiming Displays the time it took to reach the first menu, after login and after
+ *                   launch (`password_manager --timing`). It is measured in every build.
+ * 
  * @note In `DEBUG` mode, the encrypted password file is displayed 
- *       at startup, and authentication is skipped.
+ *       at startup, authentication is skipped and the startup time is always displayed.
+ */
+void runPasswordManager(const char* adminPassword, const char* vault = "passwords", bool showTiming = false);
+
+/**
+ * @brief Looks up a single password and prints it, intended for scripts.
+ * 
+ * Run as `password_manager --find <app> [--vault <name or path>]`. The master password is read from
+ * standard input (the prompt goes to standard error), then the entry is looked
+ * up with `CustomIO::FindInFile`, which reads only the part of the vault that
+ * holds it. On success the password is the only thing printed to standard output.
+ * 
+ * @param adminPassword The master password.
+ * @param app The application or website name to look up.
+ * @param vault The vault to look in, a name or a path (see `VaultCache::ResolvePath`).
+ * @return The process exit code: `0` if found, `1` if not found or access was denied.
+ */
+int runFindPassword(const char* adminPassword, const char* app, const char* vault = "passwords");
+
+/**
+ * @brief Checks the vault file for damaged lines and prints a report.
+ * 
+ * Run as `password_manager --verify [--vault <name or path>]`. Every line is checked against its
+ * checksum with `CustomIO::VerifyFile`, nothing is decrypted, so no master password is asked.
+ * 
+ * @param vault The vault to check, a name or a path (see `VaultCache::ResolvePath`).
+ * @return The process exit code: `0` if the vault is intact, `1` if it is damaged or could not be read.
+ */
+int runVerifyVault(const char* vault = "passwords");
+
+/**
+ * @brief Prints the entries that differ between a vault and another copy of it.
+ * 
+ * Run as `password_manager --diff <other> [--vault <name or path>]`. Entries are compared with
+ * `VaultMerge::Diff`, only the names of the differing entries are decrypted and printed.
+ * 
+ * @param adminPassword The master password.
+ * @param other The other copy, a name or a path (see `VaultCache::ResolvePath`).
+ * @param vault The local vault, a name or a path.
+ * @return The process exit code: `0` if the vaults hold the same entries, `1` if they differ or access was denied.
+ */
+int runDiffVaults(const char* adminPassword, const char* other, const char* vault = "passwords");
+
+/**
+ * @brief Merges another copy of a vault into the local vault.
+ * 
+ * Run as `password_manager --merge <other> [--base <base>] [--policy ours|theirs|newest] [--vault <name or path>]`.
+ * The merge is done by `VaultMerge::Merge` and replaces the local vault atomically. The added,
+ * removed and changed entries and the conflicts are printed.
+ * 
+ * @param adminPassword The master password.
+ * @param other The other copy, a name or a path.
+ * @param base The common ancestor of both copies, `nullptr` for a two-way merge.
+ * @param policy The conflict policy name (see `VaultMerge::ParsePolicy`).
+ * @param vault The local vault, a name or a path.
+ * @return The process exit code: `0` if the merge was written, `1` otherwise.
  */
-void runPasswordManager(const char* adminPassword);
+int runMergeVaults(const char* adminPassword, const char* other, const char* base, const char* policy, const char* vault = "passwords");
@@ -0,0 +1,225 @@
+/******************************************************************************
+ * Project: Password Manager - Console App
+ * File: entry_metadata.h
+ * Description:
+ *   Per-entry metadata (username, timestamps, tags, previous passwords)
+ *   kept as a struct-of-arrays table and stored as compact columns.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.2.0
+ * Author: Ghost
+ * Created On: 10-19-2026
+ * Last Modified: 10-19-2026
+ *****************************************************************************/
+
+#pragma once
+#include "secure_allocator.h"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#define EM_MAX_TAGS 64        // distinct tags per vault, each row keeps its tags as a 64-bit mask
+#define EM_HISTORY_DEPTH 5    // previous passwords kept per entry
+#define EM_NO_ROW SIZE_MAX    // returned by `Row` for a name without metadata
+#define EM_SECONDS_PER_DAY 86400
+
+/**
+ * @struct HistoryEntry
+ * @brief A previous password and the time it was replaced.
+ */
+struct HistoryEntry {
+    int64_t replaced; // unix time, seconds
+    SecureString password;
+};
+
+/**
+ * @class EntryMetadata
+ * @brief Metadata of every entry of a vault, one row per app name.
+ *
+ * The table is a struct of arrays: the fields scanned by queries (modification time and tag
+ * mask) each live in their own contiguous array, so filtering a vault touches 16 bytes per
+ * entry instead of whole records. Cold fields (usernames, history) live in separate arrays
+ * and are only read for the rows a query returns. Rows are removed by moving the last row
+ * into the hole, so they stay dense.
+ *
+ * Names are not copied once the table is bound to the vault (see `Reconcile`): rows reference
+ * the keys of its map, which stay in place as long as the entries exist. An unbound table,
+ * e.g. one just read from a file or a copy, owns its names.
+ *
+ * `Serialize` writes the table column by column with variable length integers; timestamps are
+ * delta encoded (rows sorted by creation time, modification time relative to creation), so a
+ * row usually costs a few bytes besides its strings. A timestamp of `0` means "unknown", for
+ * entries saved before metadata existed.
+ */
+class EntryMetadata {
+public:
+    EntryMetadata() = default;
+    EntryMetadata(EntryMetadata&&) = default;
+    EntryMetadata& operator=(EntryMetadata&&) = default;
+
+    /**
+     * @brief Copies the table, the copy owns its names and is not bound to any map.
+     */
+    EntryMetadata(const EntryMetadata& other);
+    EntryMetadata& operator=(const EntryMetadata& other);
+
+    /**
+     * @brief Returns the row of an app name, or #EM_NO_ROW.
+     */
+    size_t Row(std::string_view app) const;
+
+    /**
+     * @brief Number of rows.
+     */
+    size_t Size() const;
+
+    /**
+     * @brief Records that the password of `app` was set at `now`, adding a row if needed.
+     *
+     * @param app The application or website name. Once the table is bound, a key of the bound
+     *            map: the new row references it.
+     * @param now The current unix time, in seconds.
+     * @param previous The password being replaced, pushed onto the history (the oldest entry is
+     *                 dropped past #EM_HISTORY_DEPTH). `nullptr` for a new entry.
+     * @return The row of `app`.
+     */
+    size_t Touch(const std::string& app, int64_t now, const SecureString* previous = nullptr);
+
+    /**
+     * @brief Adds a row with unknown timestamps unless `app` already has one.
+     *
+     * Once the table is bound, `app` must be a key of the bound map (see `Touch`).
+     */
+    void Ensure(const std::string& app);
+
+    /**
+     * @brief Removes the row of `app`, wiping its history.
+     *
+     * Once the table is bound, call it before the entry is erased from the map.
+     *
+     * @return `true` if there was a row.
+     */
+    bool Remove(std::string_view app);
+
+    /**
+     * @brief Sets the username (login) of a row.
+     */
+    void SetUsername(size_t row, const std::string& username);
+
+    /**
+     * @brief Replaces the tags of a row.
+     *
+     * @return `false` if the vault would use more than #EM_MAX_TAGS distinct tags, the row is left unchanged.
+     */
+    bool SetTags(size_t row, const std::vector<std::string>& tags);
+
+    /**
+     * @brief Replaces the row of `from.Name(fromRow)` (adding it if needed) with a copy of that row of `from`.
+     *
+     * Used when a merge takes an entry from another copy of the vault.
+     *
+     * @return `false` if the tags could not be copied (see `SetTags`), every other field is copied anyway.
+     */
+    bool CopyRow(const EntryMetadata& from, size_t fromRow);
+
+    /**
+     * @brief Copies every row of `rows` over the row of the same name (see `CopyRow`).
+     *
+     * Used to apply the rows appended by `CustomIO::AppendChanges` to the table saved before them.
+     */
+    void Patch(const EntryMetadata& rows);
+
+    // Row accessors, `row` must be below `Size()`
+    std::string_view Name(size_t row) const;
+    const std::string& Username(size_t row) const;
+    int64_t Created(size_t row) const;
+    int64_t Modified(size_t row) const;
+    std::vector<std::string> Tags(size_t row) const;
+    const SecureVector<HistoryEntry>& History(size_t row) const;
+
+    /**
+     * @brief Finds the rows having every tag in `tags` and last modified before `modifiedBefore`.
+     *
+     * Rows with an unknown modification time count as old and match any age bound.
+     *
+     * @param tags Tags that must all be present, empty for no tag filter.
+     * @param modifiedBefore Unix time bound, `INT64_MAX` for no age filter.
+     * @return The matching rows, in table order.
+     */
+    std::vector<size_t> Filter(const std::vector<std::string>& tags, int64_t modifiedBefore) const;
+
+    /**
+     * @brief Drops the rows of names not in `names`, adds rows for names without one, and binds
+     * the table to `names`.
+     *
+     * Rows reference the keys of `names` from then on instead of holding their own copy, so rows
+     * must be removed before their entries are erased from the map.
+     *
+     * @param names Every app name of the vault, a node based map whose keys do not move.
+     */
+    template <typename Map>
+    void Reconcile(const Map& names) {
+        m_Bound = true;
+        for (const auto& entry : names) Bind(entry.first);
+
+        // Rows still owning their name have no entry in the map
+        while (!m_OwnedNames.empty()) Remove(m_OwnedNames.begin()->first);
+    }
+
+    /**
+     * @brief Estimates the memory held by the table, in bytes.
+     */
+    size_t MemoryUsage() const;
+
+    /**
+     * @brief Appends the table to `out` in its columnar format.
+     *
+     * The output holds previous passwords, it is meant to be encrypted before it is stored.
+     */
+    void Serialize(SecureString& out) const;
+
+    /**
+     * @brief Replaces the table with one read from a `Serialize` output.
+     *
+     * @return `false` if the data is malformed, the table is then left empty.
+     */
+    bool Deserialize(const char* data, size_t size);
+
+private:
+    // Returns the bit of a tag, adding it to the dictionary if needed, or -1 if the dictionary is full.
+    int TagBit(const std::string& tag);
+
+    // Drops tags no row uses any more, renumbering the masks.
+    void CompactTags();
+
+    // Adds a row for `app`, referencing it if `reference` is set, else referencing an owned copy.
+    size_t AddRow(std::string_view app, bool reference);
+
+    // Points the row of `key` (added if needed) at `key`, dropping its owned copy.
+    void Bind(const std::string& key);
+
+    // Drops the owned copy of a name if `name` references one.
+    void DropOwned(std::string_view name);
+
+    std::unordered_map<std::string_view, size_t> m_Rows; // keys reference m_Names
+    std::unordered_map<std::string_view, std::unique_ptr<std::string>> m_OwnedNames; // names of rows not bound to a map key
+    bool m_Bound = false;
+    std::vector<std::string> m_TagNames; // bit i of a mask is m_TagNames[i]
+
+    // Hot columns, scanned by Filter
+    std::vector<int64_t> m_Modified;
+    std::vector<uint64_t> m_TagMasks;
+
+    // Cold columns
+    std::vector<int64_t> m_Created;
+    std::vector<std::string_view> m_Names; // map keys or m_OwnedNames
+    std::vector<std::string> m_Usernames;
+    std::vector<SecureVector<HistoryEntry>> m_History; // newest first, in locked memory
+};
@@ -0,0 +1,151 @@
+/******************************************************************************
+ * Project: Password Manager - Console App
+ * File: password_generator.h
+ * Description:
+ *   Random password generation: a ChaCha20 based CSPRNG seeded by the
+ *   operating system, and policy driven generators running in parallel.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.2.0
+ * Author: Ghost
+ * Created On: 10-19-2026
+ * Last Modified: 10-19-2026
+ *****************************************************************************/
+
+#pragma once
+#include "secure_allocator.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#define PG_CHACHA_LANES 8      // ChaCha20 blocks computed side by side, one SIMD lane each
+#define PG_KEY_SIZE 32
+#define PG_DEFAULT_LENGTH 20
+#define PG_MAX_LENGTH 1024
+
+#define PG_CLASS_LOWER 0x1
+#define PG_CLASS_UPPER 0x2
+#define PG_CLASS_DIGITS 0x4
+#define PG_CLASS_SYMBOLS 0x8
+#define PG_CLASS_ALL (PG_CLASS_LOWER | PG_CLASS_UPPER | PG_CLASS_DIGITS | PG_CLASS_SYMBOLS)
+
+/**
+ * @class ChaCha20Rng
+ * @brief A cryptographically secure random generator built on the ChaCha20 block function.
+ *
+ * #PG_CHACHA_LANES blocks are computed at once with every state word stored lane by lane,
+ * so the rounds are plain loops over lanes that the compiler turns into SIMD instructions
+ * (SSE2, AVX2 or NEON, whatever the target offers) without intrinsics.
+ *
+ * After every refill the first 32 output bytes become the next key and are never handed out
+ * ("fast key erasure"), so a later compromise of the state does not reveal earlier output.
+ * The state and the output buffer live in the object and are wiped on destruction.
+ *
+ * @note Not thread safe, use one instance per thread.
+ */
+class ChaCha20Rng {
+public:
+    ChaCha20Rng();
+    ~ChaCha20Rng();
+    ChaCha20Rng(const ChaCha20Rng&) = delete;
+    ChaCha20Rng& operator=(const ChaCha20Rng&) = delete;
+
+    /**
+     * @brief Seeds the generator with #PG_KEY_SIZE bytes from the operating system
+     *        (`getrandom` on Linux, `BCryptGenRandom` on Windows, `getentropy` elsewhere).
+     *
+     * @return `false` if the operating system could not provide randomness, the generator must not be used then.
+     */
+    bool SeedFromSystem();
+
+    /**
+     * @brief Seeds the generator with a given key, the output is then fully determined by it.
+     */
+    void Seed(const uint8_t key[PG_KEY_SIZE]);
+
+    /**
+     * @brief Writes `size` random bytes to `out`.
+     */
+    void Fill(uint8_t* out, size_t size);
+
+    /**
+     * @brief Returns a uniformly distributed value in `[0, bound)`, without modulo bias.
+     */
+    uint32_t Uniform(uint32_t bound);
+
+private:
+    void Refill();
+
+    uint32_t m_Key[PG_KEY_SIZE / 4];
+    uint8_t m_Buffer[PG_CHACHA_LANES * 64];
+    size_t m_Position; // next unread byte of m_Buffer
+};
+
+/**
+ * @struct PasswordPolicy
+ * @brief What a generated password may contain.
+ */
+struct PasswordPolicy {
+    size_t minLength = PG_DEFAULT_LENGTH; // the length is picked uniformly in [minLength, maxLength]
+    size_t maxLength = PG_DEFAULT_LENGTH;
+    uint32_t classes = PG_CLASS_ALL;      // PG_CLASS_* flags
+    std::string extra;                    // characters allowed on top of the classes
+    std::string exclude;                  // characters never used, e.g. look-alikes such as "0O1lI"
+    bool requireEachClass = true;         // every selected class appears at least once
+};
+
+/**
+ * @class PasswordGenerator
+ * @brief Generates passwords following a `PasswordPolicy`.
+ *
+ * Characters are drawn by rejection sampling: a random byte is only used if it falls below
+ * the largest multiple of the charset size, so every character is exactly equally likely.
+ * `requireEachClass` is enforced by drawing again when a class is missing, which keeps the
+ * result uniform over every password satisfying the policy.
+ */
+class PasswordGenerator {
+public:
+    /**
+     * @brief Builds the charset of `policy` and seeds a generator from the operating system.
+     */
+    explicit PasswordGenerator(const PasswordPolicy& policy);
+
+    /**
+     * @brief Tells whether the policy can be satisfied and the generator was seeded.
+     */
+    bool IsValid() const;
+
+    /**
+     * @brief Generates one password.
+     *
+     * @param out Receives the password (it is overwritten).
+     * @return `false` if the generator is not valid.
+     */
+    bool Generate(SecureString& out);
+
+    /**
+     * @brief Generates many passwords, spread across the available hardware threads.
+     *
+     * Each thread runs its own generator, seeded separately from the operating system.
+     *
+     * @param policy The policy every password follows.
+     * @param count Number of passwords to generate.
+     * @param out Receives the passwords (it is overwritten).
+     * @return `false` if the policy is invalid or seeding failed, `out` is then empty.
+     */
+    static bool GenerateBatch(const PasswordPolicy& policy, size_t count, SecureVector<SecureString>& out);
+
+private:
+    PasswordPolicy m_Policy;
+    std::string m_Charset;
+    std::vector<uint8_t> m_ClassOf; // class index (0-3, or 4 for extra characters) of each charset character
+    uint32_t m_RequiredClasses = 0; // bit i set: class i must appear
+    uint32_t m_Limit = 0;           // random bytes at or above this value are rejected
+    bool m_Valid = false;           // the policy is satisfiable and m_Rng is seeded
+    ChaCha20Rng m_Rng;
+};
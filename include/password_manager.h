@@ -14,25 +14,34 @@
  * This source code is licensed under the MIT License. For more details, see
  * the LICENSE file in the root directory of this project.
  *
- * Version: v1.1.0
+ * Version: v1.2.0
  * Author: Ghost
  * Created On: 02-06-2025
- * Last Modified: 02-06-2025
+ * Last Modified: 10-19-2026
  *****************************************************************************/
 
 #pragma once
 #include "IEncryption.h"
+#include "bk_tree.h"
+#include "entry_metadata.h"
+#include "password_generator.h"
+#include "secure_allocator.h"
 #include <string>
 #include <unordered_map>
 #include <filesystem>
+#include <string_view>
+#include <vector>
+
+#define PM_FUZZY_MAX_DISTANCE 2 // largest edit distance a "did you mean" suggestion may have
+#define PM_FUZZY_MAX_RESULTS 5  // number of suggestions shown at most
 
 /**
  * @class PasswordManager
  * @brief Manages the storage, retrieval, and modification of user passwords.
  * 
  * This class provides functionality to add, delete, view, and save passwords
- * using an encryption interface. It ensures that any modifications trigger
- * a flag (`m_HasUpdated`) indicating unsaved changes.
+ * using an encryption interface. Every modified entry is recorded (`m_Changes`), so a
+ * commit only writes the entries whose net state differs from the saved vault.
  */
 class PasswordManager {
 private:
@@ -42,22 +51,83 @@ private:
      * 
      * This unordered map holds the credentials where:
      * - The **key** (`std::string`) represents the application or website name.
-     * - The **value** (`std::string`) is the associated password.
+     * - The **value** (`SecureString`) is the associated password, kept in locked memory
+     *   that is wiped when released.
      * 
      * The data is loaded from a file at initialization and updated as the user
      * adds or removes passwords.
      */
-    std::unordered_map<std::string, std::string> m_DataMap;
+    PasswordMap m_DataMap;
+
+    /**
+     * @brief State of a modified entry as it was when the vault was loaded or last committed.
+     */
+    struct PendingChange {
+        bool existed = false;         // the entry was in the saved vault
+        SecureString original;        // its saved password, if it existed
+        bool metadataChanged = false; // its username, tags, timestamps or history were changed
+    };
+
+    /**
+     * @brief Entries modified since the vault was loaded or last committed, by name.
+     * 
+     * An entry is recorded on its first modification only, later ones leave its saved state
+     * as it is. Comparing it with the current one gives the net change: an entry added then
+     * deleted, or changed back to its saved password, has nothing to save. The nodes hold the
+     * saved passwords (short ones inline), so they come from `SecurePool` like `PasswordMap`.
+     */
+    std::unordered_map<std::string, PendingChange, std::hash<std::string>, std::equal_to<std::string>,
+                       SecureAllocator<std::pair<const std::string, PendingChange>>> m_Changes;
 
     /**
-     * @brief Tracks whether any modifications have been made.
+     * @brief Fuzzy index over the keys of `m_DataMap`.
      * 
-     * - **`true`**: Changes have been made to `m_DataMap`, and they should be saved.
-     * - **`false`**: No changes were made, so saving is unnecessary.
+     * Kept in sync on every add and delete, used to suggest the closest app names
+     * when a lookup does not match exactly.
+     */
+    BKTree m_NameIndex;
+
+    /**
+     * @brief Username, timestamps, tags and previous passwords of every entry.
+     * 
+     * One row per key of `m_DataMap`, kept in sync on every add and delete. Rows reference the
+     * keys of `m_DataMap` rather than copying them, so a row is removed before its entry.
+     */
+    EntryMetadata m_Metadata;
+
+    /**
+     * @brief Builds a "Did you mean" message listing the app names closest to `app`.
      * 
-     * This flag ensures that data is only written to a file when needed.
+     * @param app The name that did not match.
+     * @return The message, or an empty string if no name is close enough.
      */
-    bool m_HasUpdated;
+    std::string SuggestNames(const std::string& app) const;
+
+    /**
+     * @brief Records `app` as modified, before it is changed.
+     * 
+     * @param metadataChanged `true` if its username, tags or history are about to change.
+     */
+    void RecordChange(const std::string& app, bool metadataChanged);
+
+    /**
+     * @brief Tells whether a recorded entry differs from the saved vault.
+     */
+    bool IsNetChange(const std::string& app, const PendingChange& change) const;
+
+    enum class StoreResult { Added, Updated, Unchanged };
+
+    /**
+     * @brief Sets the password of `app`, keeping the name index and the metadata in sync.
+     * 
+     * Records the change (see `RecordChange`) but does not touch the message buffer, callers
+     * report the result.
+     * 
+     * @param app The application or website name, not empty.
+     * @param pass The new password.
+     * @param now The current unix time, in seconds.
+     */
+    StoreResult StorePassword(const std::string& app, std::string_view pass, int64_t now);
 
 public:
     PasswordManager() = delete; // don't allow default constructor as the following constructors are required
@@ -66,27 +136,77 @@ public:
      * @brief Constructs a PasswordManager with preloaded data.
      * 
      * @param data Unordered map containing app-password pairs.
-     * @param encryption Pointer to an encryption strategy implementing `IEncryption`.
+     * @param metadata The entry metadata loaded with `data`. Entries without metadata get a row
+     *        with unknown timestamps, rows without an entry are dropped.
      */
-    PasswordManager(std::unordered_map<std::string, std::string>&& data);
+    PasswordManager(PasswordMap&& data, EntryMetadata&& metadata = EntryMetadata());
 
     /**
      * @brief Adds or updates a password for a given application.
      * 
+     * When an existing password changes, the previous one is kept in the entry's history
+     * (the last #EM_HISTORY_DEPTH are kept).
+     * 
      * @param app The application or website name.
      * @param pass The password associated with the app.
+     * @param username The username for the app, empty to keep the current one.
+     * @param tags Comma separated tags, empty to keep the current ones.
      */
-    void AddPassword(std::string& app, std::string& pass);
+    void AddPassword(std::string& app, std::string& pass, const std::string& username = "", const std::string& tags = "");
+
+    /**
+     * @brief Generates and stores a password for every app in `apps`.
+     * 
+     * Passwords are generated in parallel by `PasswordGenerator::GenerateBatch`. Existing entries
+     * get a new password and keep the previous one in their history. A single summary message is
+     * displayed instead of one per entry.
+     * 
+     * @param apps The application or website names, empty names are skipped.
+     * @param policy What the generated passwords contain.
+     * @return The number of entries added or changed, `0` if the policy is invalid.
+     */
+    size_t GeneratePasswords(const std::vector<std::string>& apps, const PasswordPolicy& policy);
 
     /**
      * @brief Deletes a password entry if it exists.
      * 
      * @param app The application or website name whose password should be deleted.
      * 
-     * @note If the entry does not exist, an error message is displayed.
+     * @note If the entry does not exist, an error message is displayed along with the closest app names.
      */
     void DeletePassword(std::string& app);
 
+    /**
+     * @brief Displays the password saved for a given application.
+     * 
+     * @param app The application or website name to look up.
+     * 
+     * @note If the entry does not exist, the closest app names are suggested instead.
+     */
+    void FindPassword(std::string& app);
+
+    /**
+     * @brief Finds the saved app names closest to a (possibly misspelled) name.
+     * 
+     * The search is bounded by #PM_FUZZY_MAX_DISTANCE edits and returns at most
+     * #PM_FUZZY_MAX_RESULTS names, closest first.
+     * 
+     * @param app The name to look for.
+     * @return The closest saved app names.
+     */
+    std::vector<std::string> FindSimilar(const std::string& app) const;
+
+    /**
+     * @brief Lists the entries having every given tag and not changed for a given number of days.
+     * 
+     * Passwords are not displayed, only names, usernames, tags and ages. Entries saved
+     * before metadata existed have an unknown age and are listed by any age filter.
+     * 
+     * @param tags Comma separated tags that must all be present, empty for no tag filter.
+     * @param olderThanDays Only list passwords last changed more than this many days ago, `0` for no age filter.
+     */
+    void FilterPasswords(const std::string& tags, int olderThanDays);
+
     /**
      * @brief Displays all saved passwords.
      * 
@@ -97,11 +217,30 @@ public:
     /**
      * @brief Saves password data to a file if changes have been made.
      * 
+     * Only the entries that differ from the saved vault are written, appended to the file by
+     * `CustomIO::AppendChanges`. The whole vault is written again when appending is declined
+     * (no valid index, or the appended changes grew too large).
+     * 
      * @param filePath Path to the file where password data will be stored.
+     * @param encryption The encryption strategy used to encrypt the data.
+     * @param compress If `true`, a full write uses compressed blocks (see `CustomIO::SaveToFile`).
      * @return `true` if data was successfully saved, `false` otherwise.
      * 
-     * @note If no modifications were made, saving is skipped.
+     * @note If no entry differs from the saved vault, saving is skipped.
+     */
+    bool CommitData(std::filesystem::path& filePath, const IEncryption& encryption, bool compress = false);
+
+    /**
+     * @brief Tells whether there are changes that `CommitData` would save.
+     */
+    bool HasChanges() const;
+
+    /**
+     * @brief Estimates the memory held by the loaded entries, in bytes.
+     * 
+     * Counts the names, the passwords and the per-entry overhead of the map and the name index.
+     * Used by `VaultCache` to bound the memory of the vaults it keeps open.
      */
-    bool CommitData(std::filesystem::path& filePath, const IEncryption& encryption);
+    size_t MemoryUsage() const;
 
 };
\ No newline at end of file
@@ -0,0 +1,208 @@
+/******************************************************************************
+ * Project: Password Manager - Console App
+ * File: secure_allocator.h
+ * Description:
+ *   A pool of locked memory pages for decrypted secrets, and the allocator and
+ *   string/map types built on top of it.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.2.0
+ * Author: Ghost
+ * Created On: 10-19-2026
+ * Last Modified: 10-19-2026
+ *****************************************************************************/
+
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#define SECURE_POOL_MIN_BLOCK 16            // smallest size class
+#define SECURE_POOL_CLASSES 9               // size classes 16, 32, ..., 4096 bytes
+#define SECURE_POOL_CHUNK (256 * 1024)      // bytes mapped (and locked) at a time for the size classes
+#define SECURE_POOL_LARGE_CLASSES 8         // large classes 8 KiB, 16 KiB, ..., 1 MiB, one mapping per block
+#define SECURE_POOL_LARGE_CACHE (8 * 1024 * 1024) // bytes of freed large blocks kept mapped for reuse
+#define SECURE_POOL_THREAD_CACHE 64         // freed blocks a thread keeps per size class before returning them
+
+/**
+ * @class SecurePool
+ * @brief A process wide pool of memory that is locked in RAM and wiped when freed.
+ *
+ * Memory is mapped in chunks of #SECURE_POOL_CHUNK bytes, locked with `mlock` (`VirtualLock`
+ * on Windows) so it is never written to swap, and excluded from core dumps where supported.
+ * Chunks are carved into power of two size classes kept on free lists, so once the pool is
+ * warm an allocation is a free list pop and costs no system call. Every block is zeroed
+ * before it goes back on its free list. Each thread keeps a few freed blocks per size class
+ * of its own, which it reuses without taking the pool lock.
+ *
+ * Requests larger than the biggest size class get their own locked mapping, rounded up to a
+ * power of two up to 1 MiB. Those mappings are wiped and kept on free lists as well, up to
+ * #SECURE_POOL_LARGE_CACHE bytes, so growing buffers (block payloads, whole vault strings)
+ * do not map and unmap pages on every call. Larger requests are mapped and unmapped directly.
+ *
+ * Chunks are not returned to the system one by one: freed blocks stay on their free lists, so
+ * the locked footprint of the size classes is the peak of the blocks in use at once (about the
+ * size of the largest vault opened). It is released when the pool drains, i.e. when no block of
+ * a size class is in use anywhere, thread caches included; `Trim` hands the calling thread's
+ * blocks back first, and drops the cached large blocks as well.
+ *
+ * If the operating system refuses to lock memory (e.g. `RLIMIT_MEMLOCK` is too low) the pool
+ * keeps working without the lock and logs a single warning.
+ */
+class SecurePool {
+public:
+    /**
+     * @brief Returns the process wide pool.
+     */
+    static SecurePool& Instance();
+
+    /**
+     * @brief Allocates `size` bytes of locked memory.
+     *
+     * @throws std::bad_alloc if no memory could be mapped.
+     */
+    void* Allocate(size_t size);
+
+    /**
+     * @brief Wipes and releases memory returned by `Allocate`.
+     *
+     * @param ptr The memory to release.
+     * @param size The size that was passed to `Allocate`.
+     */
+    void Deallocate(void* ptr, size_t size);
+
+    /**
+     * @brief Overwrites memory with zeros in a way the compiler cannot optimize away.
+     */
+    static void Wipe(void* ptr, size_t size);
+
+    /**
+     * @brief Overwrites the contents of a regular string with zeros and clears it.
+     *
+     * Used for temporaries (user input, formatted messages) that held a secret.
+     */
+    static void Wipe(std::string& str);
+
+    /**
+     * @brief Returns memory the pool holds but does not use to the system.
+     *
+     * The calling thread's cached blocks go back to the pool and the cached large blocks are
+     * unmapped. If no block of a size class is in use anymore, every chunk is unmapped too.
+     */
+    void Trim();
+
+private:
+    SecurePool() = default;
+
+    /**
+     * @brief Maps `size` bytes of memory and tries to lock them.
+     */
+    void* MapPages(size_t size);
+
+    /**
+     * @brief Releases memory mapped by `MapPages`.
+     */
+    static void UnmapPages(void* ptr, size_t size);
+
+    /**
+     * @brief Intrusive free list node, stored inside the free block itself.
+     */
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    /**
+     * @brief The freed blocks a thread keeps for itself, handed back to the pool when it exits.
+     */
+    struct ThreadCache {
+        FreeBlock* lists[SECURE_POOL_CLASSES] = {};
+        size_t counts[SECURE_POOL_CLASSES] = {};
+        ~ThreadCache();
+    };
+
+    /**
+     * @brief Returns the cache of the calling thread, `nullptr` once it has been destroyed at thread exit.
+     */
+    static ThreadCache* LocalCache();
+
+    /**
+     * @brief Moves `count` blocks of a size class from a thread cache to the pool (the lock is taken).
+     */
+    void Release(ThreadCache& cache, int sizeClass, size_t count);
+
+    void* AllocateLarge(size_t size);
+    void DeallocateLarge(void* ptr, size_t size);
+
+    /**
+     * @brief Unmaps every chunk and empties the size class free lists, the lock must be held and no block be in use.
+     */
+    void ReleaseChunks();
+
+    std::mutex m_Mutex;
+    FreeBlock* m_FreeLists[SECURE_POOL_CLASSES] = {};
+    FreeBlock* m_LargeFreeLists[SECURE_POOL_LARGE_CLASSES] = {};
+    size_t m_LargeCached = 0;  // bytes held by the large free lists
+    char* m_Chunk = nullptr;   // chunk currently being carved into blocks
+    size_t m_ChunkUsed = 0;
+    std::vector<char*> m_Chunks; // every chunk mapped for the size classes
+    size_t m_Outstanding = 0;  // size class blocks out of the pool (in use or in a thread cache)
+    bool m_LockWarned = false;
+};
+
+/**
+ * @class SecureAllocator
+ * @brief A standard library allocator that takes its memory from `SecurePool`.
+ */
+template <typename T>
+class SecureAllocator {
+public:
+    using value_type = T;
+
+    SecureAllocator() noexcept = default;
+
+    template <typename U>
+    SecureAllocator(const SecureAllocator<U>&) noexcept {}
+
+    T* allocate(size_t count) {
+        return static_cast<T*>(SecurePool::Instance().Allocate(count * sizeof(T)));
+    }
+
+    void deallocate(T* ptr, size_t count) noexcept {
+        SecurePool::Instance().Deallocate(ptr, count * sizeof(T));
+    }
+
+    template <typename U>
+    bool operator==(const SecureAllocator<U>&) const noexcept { return true; }
+
+    template <typename U>
+    bool operator!=(const SecureAllocator<U>&) const noexcept { return false; }
+};
+
+/**
+ * @brief A string whose characters live in locked memory and are wiped when released.
+ */
+using SecureString = std::basic_string<char, std::char_traits<char>, SecureAllocator<char>>;
+
+/**
+ * @brief A vector whose elements live in locked memory, for lists of secrets (and of strings
+ * holding short secrets inline).
+ */
+template <typename T>
+using SecureVector = std::vector<T, SecureAllocator<T>>;
+
+/**
+ * @brief The in-memory vault: app name -> password.
+ *
+ * Both the passwords and the map nodes (which hold short passwords inline) are allocated
+ * from `SecurePool`.
+ */
+using PasswordMap = std::unordered_map<std::string, SecureString, std::hash<std::string>, std::equal_to<std::string>,
+                                       SecureAllocator<std::pair<const std::string, SecureString>>>;
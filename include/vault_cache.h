@@ -0,0 +1,124 @@
+/******************************************************************************
+ * Project: Password Manager - Console App
+ * File: vault_cache.h
+ * Description:
+ *   Keeps several unlocked vaults open at once, closing the least recently
+ *   used one when a count or memory limit is reached.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.2.0
+ * Author: Ghost
+ * Created On: 10-19-2026
+ * Last Modified: 10-19-2026
+ *****************************************************************************/
+
+#pragma once
+#include "IEncryption.h"
+#include "password_manager.h"
+#include <filesystem>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#define VC_MAX_VAULTS 8                  // vaults kept open at most
+#define VC_MAX_BYTES (64 * 1024 * 1024)  // estimated memory the open vaults may use (see PasswordManager::MemoryUsage)
+
+/**
+ * @class VaultCache
+ * @brief An LRU cache of loaded vaults (`PasswordManager` instances), keyed by file path.
+ *
+ * Switching back to a vault that is still open skips reading and decrypting its file. When
+ * more than `maxVaults` vaults are open, or their estimated memory exceeds `maxBytes`, the least
+ * recently used vault is closed: its changes are committed, then it is destroyed, which wipes
+ * its secrets (see `SecurePool`). The vault in use is never closed. The limits are checked when
+ * a vault is opened, and by `EvictOverLimit` after the vault in use has grown.
+ *
+ * @note Not thread safe, it is meant to be used by the menu loop only.
+ */
+class VaultCache {
+public:
+    /**
+     * @param encryption The encryption strategy used to load and save every vault.
+     * @param compress Forwarded to `PasswordManager::CommitData` when a vault is saved.
+     * @param maxVaults The number of vaults kept open at most.
+     * @param maxBytes The estimated memory the open vaults may use.
+     */
+    VaultCache(const IEncryption& encryption, bool compress = false, size_t maxVaults = VC_MAX_VAULTS, size_t maxBytes = VC_MAX_BYTES);
+
+    /**
+     * @brief Returns the vault stored at `path`, loading it unless it is already open.
+     *
+     * A missing file opens as an empty vault, it is created on the first commit.
+     * The vault becomes the most recently used one.
+     *
+     * @param path The path of the vault file.
+     * @return The vault, valid until it is evicted.
+     */
+    PasswordManager& Open(const std::filesystem::path& path);
+
+    /**
+     * @brief Adds a vault whose file has already been decrypted (e.g. by the startup prefetch).
+     *
+     * @param path The path of the vault file.
+     * @param data The decrypted entries.
+     * @param metadata The entry metadata decrypted with them.
+     * @return The vault, valid until it is evicted.
+     */
+    PasswordManager& Insert(const std::filesystem::path& path, PasswordMap&& data, EntryMetadata&& metadata = EntryMetadata());
+
+    /**
+     * @brief Commits every open vault that has changes.
+     *
+     * Vaults saved when they were closed (see `EvictOverLimit`) since the last call count as saved.
+     *
+     * @return `true` if at least one vault was saved and none failed, `false` otherwise
+     *         (a message explaining why is added to the terminal buffer).
+     */
+    bool CommitAll();
+
+    /**
+     * @brief Closes least recently used vaults until the limits hold again, the most recent one is kept.
+     *
+     * A vault whose changes cannot be committed stays open, over the limits, rather than losing
+     * them; the next older vault is closed instead.
+     *
+     * @return `false` if a vault could not be saved and the limits still do not hold (a message
+     *         explaining why is added to the terminal buffer), `true` otherwise.
+     */
+    bool EvictOverLimit();
+
+    /**
+     * @brief Number of vaults currently open.
+     */
+    size_t Size() const;
+
+    /**
+     * @brief Turns a vault name or path into the path of its file.
+     *
+     * A bare name (`team`) resolves to #FIO_EXT file in the working directory, like the default
+     * vault. A path keeps its directory, #FIO_EXT is added if it has no extension.
+     */
+    static std::filesystem::path ResolvePath(const std::string& nameOrPath);
+
+private:
+    struct Entry {
+        std::filesystem::path path;
+        std::unique_ptr<PasswordManager> manager;
+    };
+
+    // Makes the key for a path, so that two spellings of the same file share an entry.
+    static std::string MakeKey(const std::filesystem::path& path);
+
+    const IEncryption& m_Encryption;
+    bool m_Compress;
+    size_t m_MaxVaults;
+    size_t m_MaxBytes;
+    bool m_SavedOnEviction = false; // a closed vault had changes that were committed, reported by CommitAll
+    std::list<Entry> m_Entries; // most recently used first
+    std::unordered_map<std::string, std::list<Entry>::iterator> m_Lookup;
+};
@@ -0,0 +1,143 @@
+/******************************************************************************
+ * Project: Password Manager - Console App
+ * File: vault_index.h
+ * Description:
+ *   A small on-disk index stored next to a vault file. It holds a Bloom filter
+ *   and a hash table of key hashes so a single entry can be found without
+ *   loading and decrypting the whole vault.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.2.0
+ * Author: Ghost
+ * Created On: 10-19-2026
+ * Last Modified: 10-19-2026
+ *****************************************************************************/
+
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#define FIO_INDEX_EXT ".pwdx"
+
+/**
+ * @struct IndexEntry
+ * @brief One key of the vault: the hash of its encrypted name and the byte offset of the line holding it.
+ */
+struct IndexEntry {
+    uint64_t hash;
+    uint64_t offset;
+};
+
+/**
+ * @class VaultIndex
+ * @brief Reads and writes the key-hash index (#FIO_INDEX_EXT) of a vault file.
+ *
+ * The index file is laid out as:
+ * - A fixed header (magic, version, size and fingerprint of the vault it describes, counts).
+ * - A blocked Bloom filter, 64 byte blocks, one block per query, so a "not present" answer costs a single small read.
+ * - An open addressing hash table of `IndexEntry` slots, so a present key costs one or two small reads.
+ *
+ * Keys are hashed in their **encrypted** form, the index therefore reveals nothing the vault file does not.
+ * An index describes the vault as it was written in full, of the size recorded in its header. Changes
+ * appended to the vault later (see `CustomIO::AppendChanges`) are past that size and are not indexed.
+ * The header also holds a CRC32C of the size and of the first and last 4 KiB of that part, so an index
+ * left next to another vault (e.g. a larger copy synced from another host) is rejected instead of
+ * being trusted with the other vault's tail taken for appended changes.
+ *
+ * The fingerprint does not cover the middle of the indexed part, so an edit there that keeps the size
+ * passes it. Such an edit does move the modification time of the vault past the one of its index, which
+ * is written after the vault and brought forward on every append (see `IsCurrent`, `Refresh`).
+ */
+class VaultIndex {
+public:
+    /**
+     * @brief Hashes an encrypted key into the 64-bit value stored in the index.
+     *
+     * @param encryptedKey The key as it is written in the vault file.
+     * @return The hash, never `0` (reserved for empty slots).
+     */
+    static uint64_t HashKey(std::string_view encryptedKey);
+
+    /**
+     * @brief Writes an index describing a vault file.
+     *
+     * @param indexPath The path of the index file to write.
+     * @param entries One entry per key in the vault.
+     * @param vaultPath The vault file, already written, its indexed part is fingerprinted.
+     * @param vaultSize The size in bytes of the vault file the offsets refer to.
+     * @return `true` if the index was written, `false` otherwise.
+     */
+    static bool Write(const std::filesystem::path& indexPath, const std::vector<IndexEntry>& entries, const std::filesystem::path& vaultPath, uint64_t vaultSize);
+
+    /**
+     * @brief Opens an index for queries.
+     *
+     * @param indexPath The path of the index file.
+     * @param vaultPath The vault file, checked against the fingerprint of the index.
+     * @param vaultSize The current size of the vault file, an index written for a larger vault is rejected.
+     * @return `true` if the index is usable, `false` if it is missing, damaged or stale.
+     */
+    bool Open(const std::filesystem::path& indexPath, const std::filesystem::path& vaultPath, uint64_t vaultSize);
+
+    /**
+     * @brief Size of the part of the vault the open index describes, the bytes after it are appended changes.
+     */
+    uint64_t IndexedSize() const;
+
+    /**
+     * @brief Reads the size of the vault an index describes, without opening it for queries.
+     *
+     * The index is checked against the vault as `Open` does.
+     *
+     * @return `false` if the index is missing, damaged or stale.
+     */
+    static bool ReadIndexedSize(const std::filesystem::path& indexPath, const std::filesystem::path& vaultPath, uint64_t vaultSize, uint64_t& indexedSize);
+
+    /**
+     * @brief Checks that an index was written, or refreshed, no earlier than the last change to its vault file.
+     *
+     * When it is not, the vault was changed by something else than `CustomIO`, maybe inside the indexed
+     * part, and a "not present" answer from the index cannot be trusted.
+     */
+    static bool IsCurrent(const std::filesystem::path& indexPath, const std::filesystem::path& vaultPath);
+
+    /**
+     * @brief Gives an index the modification time of its vault, after changes were appended to a vault it was current for.
+     */
+    static void Refresh(const std::filesystem::path& indexPath, const std::filesystem::path& vaultPath);
+
+    /**
+     * @brief Whether the open index was current for its vault (see `IsCurrent`) when it was opened.
+     */
+    bool IsCurrent() const;
+
+    /**
+     * @brief Checks the Bloom filter for a key hash.
+     *
+     * @return `false` if the key is certainly not in the vault, `true` if it may be.
+     */
+    bool MayContain(uint64_t hash);
+
+    /**
+     * @brief Collects the vault offsets of every slot holding the given hash.
+     *
+     * @param hash The key hash to look up.
+     * @param offsets Receives the candidate offsets (normally zero or one).
+     */
+    void FindOffsets(uint64_t hash, std::vector<uint64_t>& offsets);
+
+private:
+    std::ifstream m_File;
+    uint64_t m_BloomBlocks = 0;
+    uint64_t m_SlotCount = 0;
+    uint64_t m_IndexedSize = 0;
+    bool m_Current = false;
+};
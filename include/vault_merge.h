@@ -0,0 +1,127 @@
+/******************************************************************************
+ * Project: Password Manager - Console App
+ * File: vault_merge.h
+ * Description:
+ *   Compares copies of a vault and merges them (two-way or three-way with a
+ *   common base), streaming the files instead of loading them.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.2.0
+ * Author: Ghost
+ * Created On: 10-19-2026
+ * Last Modified: 10-19-2026
+ *****************************************************************************/
+
+#pragma once
+#include "IEncryption.h"
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#define VM_TEMP_EXT ".tmp" // appended to the output path while a merge is written
+
+/**
+ * @brief How a merge resolves an entry changed differently on both sides.
+ */
+enum class MergePolicy {
+    Ours,   // keep the local entry
+    Theirs, // take the other copy's entry
+    Newest  // take the entry changed last (see `EntryMetadata::Modified`), the local one on a tie
+};
+
+/**
+ * @brief What a diff or merge does to an entry of the local vault.
+ */
+enum class MergeChange { Added, Removed, Changed, Kept };
+
+/**
+ * @struct MergeEntry
+ * @brief One entry a diff or merge reports, identified by its name only.
+ */
+struct MergeEntry {
+    std::string app;
+    MergeChange change;
+    bool conflict; // both sides changed the entry, `change` is how the policy resolved it
+};
+
+/**
+ * @struct MergeReport
+ * @brief Result of `VaultMerge::Diff` and `VaultMerge::Merge`.
+ */
+struct MergeReport {
+    size_t added = 0;
+    size_t removed = 0;
+    size_t changed = 0;
+    size_t unchanged = 0;
+    size_t conflicts = 0;
+    size_t damaged = 0;               // damaged lines found in the inputs
+    std::vector<MergeEntry> entries;  // added, removed and changed entries, and every conflict
+};
+
+/**
+ * @class VaultMerge
+ * @brief Diff and merge of vault files that share an encryption module.
+ *
+ * Records are compared by hashes of their encrypted fields, read with `CustomIO::ScanFile`:
+ * the key sets are hash-joined on the hash of the encrypted name (the same one `VaultIndex`
+ * uses), and two versions of an entry are equal when their encrypted passwords hash the same.
+ * Only the names of the entries that differ are decrypted, for the report. Like the index,
+ * this relies on the encryption module giving the same output for the same input.
+ *
+ * Memory stays bounded by the number of entries, never by their size: every vault is reduced
+ * to a hash table of the fingerprints of its final entries (24 byte slots, at most half full),
+ * which also resolves changes appended after the last full save, then the local vault is
+ * streamed again and the other copy a second time for the entries only it has. Merged records
+ * are copied as they are stored, without being encrypted again.
+ *
+ * @note Two different names whose encrypted forms share a 64-bit hash would be seen as one entry.
+ */
+class VaultMerge {
+public:
+    /**
+     * @brief Lists what differs between two vaults, from the point of view of `ours`.
+     *
+     * @param ours The local vault.
+     * @param theirs The vault compared with it, its entries count as added, removed or changed.
+     * @param encryption The encryption module of both vaults.
+     * @param report Receives the differences.
+     * @return `false` if a vault could not be read.
+     */
+    static bool Diff(const std::filesystem::path& ours, const std::filesystem::path& theirs, const IEncryption& encryption, MergeReport& report);
+
+    /**
+     * @brief Merges two copies of a vault into `output`.
+     *
+     * With a `base` (the last version both copies share) the merge is three-way: an entry changed
+     * or removed on one side only takes that change, and only an entry changed differently on both
+     * sides is a conflict. Without a base, every entry of either side is kept and an entry present
+     * on both sides with different passwords is a conflict. Conflicts are resolved by `policy`.
+     *
+     * The result is written next to `output` and renamed over it once complete, so `output` is
+     * either the old file or the whole merge, never a partial one. The entry metadata of every
+     * merged entry comes with it.
+     *
+     * @param base The common ancestor, an empty path for a two-way merge.
+     * @param ours The local vault.
+     * @param theirs The other copy.
+     * @param output Where the merge is written, it may be `ours`.
+     * @param encryption The encryption module of every vault.
+     * @param policy How conflicts are resolved.
+     * @param report Receives what the merge changed compared to `ours`.
+     * @return `false` if a vault could not be read, an input has damaged lines (nothing is written
+     *         then, see `CustomIO::VerifyFile`) or the output could not be written.
+     */
+    static bool Merge(const std::filesystem::path& base, const std::filesystem::path& ours, const std::filesystem::path& theirs,
+        const std::filesystem::path& output, const IEncryption& encryption, MergePolicy policy, MergeReport& report);
+
+    /**
+     * @brief Reads a policy name: "ours", "theirs" or "newest".
+     *
+     * @return `false` if the name is unknown.
+     */
+    static bool ParsePolicy(const std::string& name, MergePolicy& policy);
+};
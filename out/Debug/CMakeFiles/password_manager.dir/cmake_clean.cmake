@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/password_manager.dir/src/driver.cpp.o"
+  "CMakeFiles/password_manager.dir/src/driver.cpp.o.d"
+  "CMakeFiles/password_manager.dir/src/main.cpp.o"
+  "CMakeFiles/password_manager.dir/src/main.cpp.o.d"
+  "password_manager"
+  "password_manager.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/password_manager.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libpassword_manager_core.a"
+)
@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/HexE.cpp" "CMakeFiles/password_manager_core.dir/src/HexE.cpp.o" "gcc" "CMakeFiles/password_manager_core.dir/src/HexE.cpp.o.d"
+  "/root/repo/src/bk_tree.cpp" "CMakeFiles/password_manager_core.dir/src/bk_tree.cpp.o" "gcc" "CMakeFiles/password_manager_core.dir/src/bk_tree.cpp.o.d"
+  "/root/repo/src/block_codec.cpp" "CMakeFiles/password_manager_core.dir/src/block_codec.cpp.o" "gcc" "CMakeFiles/password_manager_core.dir/src/block_codec.cpp.o.d"
+  "/root/repo/src/checksum.cpp" "CMakeFiles/password_manager_core.dir/src/checksum.cpp.o" "gcc" "CMakeFiles/password_manager_core.dir/src/checksum.cpp.o.d"
+  "/root/repo/src/custom_io.cpp" "CMakeFiles/password_manager_core.dir/src/custom_io.cpp.o" "gcc" "CMakeFiles/password_manager_core.dir/src/custom_io.cpp.o.d"
+  "/root/repo/src/custom_terminal.cpp" "CMakeFiles/password_manager_core.dir/src/custom_terminal.cpp.o" "gcc" "CMakeFiles/password_manager_core.dir/src/custom_terminal.cpp.o.d"
+  "/root/repo/src/entry_metadata.cpp" "CMakeFiles/password_manager_core.dir/src/entry_metadata.cpp.o" "gcc" "CMakeFiles/password_manager_core.dir/src/entry_metadata.cpp.o.d"
+  "/root/repo/src/logger.cpp" "CMakeFiles/password_manager_core.dir/src/logger.cpp.o" "gcc" "CMakeFiles/password_manager_core.dir/src/logger.cpp.o.d"
+  "/root/repo/src/password_generator.cpp" "CMakeFiles/password_manager_core.dir/src/password_generator.cpp.o" "gcc" "CMakeFiles/password_manager_core.dir/src/password_generator.cpp.o.d"
+  "/root/repo/src/password_manager.cpp" "CMakeFiles/password_manager_core.dir/src/password_manager.cpp.o" "gcc" "CMakeFiles/password_manager_core.dir/src/password_manager.cpp.o.d"
+  "/root/repo/src/secure_allocator.cpp" "CMakeFiles/password_manager_core.dir/src/secure_allocator.cpp.o" "gcc" "CMakeFiles/password_manager_core.dir/src/secure_allocator.cpp.o.d"
+  "/root/repo/src/vault_cache.cpp" "CMakeFiles/password_manager_core.dir/src/vault_cache.cpp.o" "gcc" "CMakeFiles/password_manager_core.dir/src/vault_cache.cpp.o.d"
+  "/root/repo/src/vault_index.cpp" "CMakeFiles/password_manager_core.dir/src/vault_index.cpp.o" "gcc" "CMakeFiles/password_manager_core.dir/src/vault_index.cpp.o.d"
+  "/root/repo/src/vault_merge.cpp" "CMakeFiles/password_manager_core.dir/src/vault_merge.cpp.o" "gcc" "CMakeFiles/password_manager_core.dir/src/vault_merge.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
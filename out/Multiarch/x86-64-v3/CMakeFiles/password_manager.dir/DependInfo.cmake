@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/driver.cpp" "CMakeFiles/password_manager.dir/src/driver.cpp.o" "gcc" "CMakeFiles/password_manager.dir/src/driver.cpp.o.d"
+  "/root/repo/src/main.cpp" "CMakeFiles/password_manager.dir/src/main.cpp.o" "gcc" "CMakeFiles/password_manager.dir/src/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/out/Multiarch/x86-64-v3/CMakeFiles/password_manager_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "/root/repo/out/Multiarch/password_manager-x86-64-v3"
+  "/root/repo/out/Multiarch/password_manager-x86-64-v3.pdb"
+  "CMakeFiles/password_manager.dir/src/driver.cpp.o"
+  "CMakeFiles/password_manager.dir/src/driver.cpp.o.d"
+  "CMakeFiles/password_manager.dir/src/main.cpp.o"
+  "CMakeFiles/password_manager.dir/src/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/password_manager.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
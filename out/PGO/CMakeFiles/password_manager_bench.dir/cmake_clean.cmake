@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/password_manager_bench.dir/bench/benchmark.cpp.o"
+  "CMakeFiles/password_manager_bench.dir/bench/benchmark.cpp.o.d"
+  "CMakeFiles/password_manager_bench.dir/bench/vault_generator.cpp.o"
+  "CMakeFiles/password_manager_bench.dir/bench/vault_generator.cpp.o.d"
+  "password_manager_bench"
+  "password_manager_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/password_manager_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,37 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/password_manager_core.dir/src/HexE.cpp.o"
+  "CMakeFiles/password_manager_core.dir/src/HexE.cpp.o.d"
+  "CMakeFiles/password_manager_core.dir/src/bk_tree.cpp.o"
+  "CMakeFiles/password_manager_core.dir/src/bk_tree.cpp.o.d"
+  "CMakeFiles/password_manager_core.dir/src/block_codec.cpp.o"
+  "CMakeFiles/password_manager_core.dir/src/block_codec.cpp.o.d"
+  "CMakeFiles/password_manager_core.dir/src/checksum.cpp.o"
+  "CMakeFiles/password_manager_core.dir/src/checksum.cpp.o.d"
+  "CMakeFiles/password_manager_core.dir/src/custom_io.cpp.o"
+  "CMakeFiles/password_manager_core.dir/src/custom_io.cpp.o.d"
+  "CMakeFiles/password_manager_core.dir/src/custom_terminal.cpp.o"
+  "CMakeFiles/password_manager_core.dir/src/custom_terminal.cpp.o.d"
+  "CMakeFiles/password_manager_core.dir/src/entry_metadata.cpp.o"
+  "CMakeFiles/password_manager_core.dir/src/entry_metadata.cpp.o.d"
+  "CMakeFiles/password_manager_core.dir/src/logger.cpp.o"
+  "CMakeFiles/password_manager_core.dir/src/logger.cpp.o.d"
+  "CMakeFiles/password_manager_core.dir/src/password_generator.cpp.o"
+  "CMakeFiles/password_manager_core.dir/src/password_generator.cpp.o.d"
+  "CMakeFiles/password_manager_core.dir/src/password_manager.cpp.o"
+  "CMakeFiles/password_manager_core.dir/src/password_manager.cpp.o.d"
+  "CMakeFiles/password_manager_core.dir/src/secure_allocator.cpp.o"
+  "CMakeFiles/password_manager_core.dir/src/secure_allocator.cpp.o.d"
+  "CMakeFiles/password_manager_core.dir/src/vault_cache.cpp.o"
+  "CMakeFiles/password_manager_core.dir/src/vault_cache.cpp.o.d"
+  "CMakeFiles/password_manager_core.dir/src/vault_index.cpp.o"
+  "CMakeFiles/password_manager_core.dir/src/vault_index.cpp.o.d"
+  "CMakeFiles/password_manager_core.dir/src/vault_merge.cpp.o"
+  "CMakeFiles/password_manager_core.dir/src/vault_merge.cpp.o.d"
+  "libpassword_manager_core.a"
+  "libpassword_manager_core.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/password_manager_core.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
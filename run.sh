@@ -3,6 +3,17 @@
 BUILD_TYPE=${1:-"Debug"}  # Default to Debug if no argument is provided
 EXECUTABLE="out/$BUILD_TYPE/password_manager"
 
+# Multiarch builds: run the binary of the highest x86-64 level this CPU supports (lzcnt shows as abm)
+if [ "$BUILD_TYPE" == "Multiarch" ]; then
+    FLAGS=" $(grep -m1 '^flags' /proc/cpuinfo 2>/dev/null) "
+    has() { for flag in "$@"; do [[ "$FLAGS" == *" $flag "* ]] || return 1; done; }
+    LEVEL="x86-64"
+    has cx16 lahf_lm popcnt sse4_1 sse4_2 ssse3 && LEVEL="x86-64-v2"
+    [ "$LEVEL" == "x86-64-v2" ] && has avx avx2 bmi1 bmi2 f16c fma movbe abm xsave && LEVEL="x86-64-v3"
+    [ "$LEVEL" == "x86-64-v3" ] && has avx512f avx512bw avx512cd avx512dq avx512vl && LEVEL="x86-64-v4"
+    EXECUTABLE="out/Multiarch/password_manager-$LEVEL"
+fi
+
 if [ -f "$EXECUTABLE" ]; then
     echo "Running Password Manager..."
     "$EXECUTABLE"
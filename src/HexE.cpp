@@ -10,10 +10,10 @@
  * This source code is licensed under the MIT License. For more details, see
  * the LICENSE file in the root directory of this project.
  *
- * Version: v1.0
+ * Version: v1.2.0
  * Author: Ghost
  * Created On: 1-28-2025
- * Last Modified: 1-29-2025
+ * Last Modified: 10-19-2026
  *****************************************************************************/
 
 #include "../include/HexE.h"
@@ -23,33 +23,36 @@ std::string HEXEncryption::encrypt(const std::string& input) const {
     // Optimization: Preallocate memory using a vector to avoid multiple dynamic allocations.
     // Using direct indexing instead of `std::string::append()` improves performance.
 
-    static constexpr char hexDigits[] = "0123456789ABCDEF";
-
     std::vector<char> buffer(input.size() * 2); // Each byte -> 2 hex chars
-    size_t index = 0;
-
-    for (unsigned char c : input) {
-        buffer[index++] = hexDigits[c >> 4];  // High nibble
-        buffer[index++] = hexDigits[c & 0x0F]; // Low nibble
-    }
+    EncodeTo(input.data(), input.size(), buffer.data());
 
     return std::string(buffer.begin(), buffer.end());
 }
 
 std::string HEXEncryption::decrypt(const std::string& input) const {
-    // Optimization: Preallocate buffer to prevent repeated reallocations.
-    // Uses direct character-to-hex conversion instead of `std::stoi(std::string(1, c))`, reducing unnecessary object creation.
-
-    std::vector<char> buffer(input.length() / 2);
-    size_t index = 0;
-
-    for (size_t i = 0; i < input.length(); i += 2) {
-        char high = input[i];
-        char low = input[i + 1];
-        int highValue = std::isdigit(high) ? high - '0' : std::toupper(high) - 'A' + 10;
-        int lowValue  = std::isdigit(low)  ? low - '0'  : std::toupper(low) - 'A' + 10;
-        buffer[index++] = (highValue << 4) | lowValue;
-    }
-    
-    return std::string(buffer.begin(), buffer.end());
+    // Decode into secure memory, which is wiped when released, the only plaintext copy left is the result
+    SecureString plain;
+    if (!decryptSecure(input, plain)) return std::string(); // odd length or not hex
+
+    return std::string(plain.data(), plain.size());
+}
+
+std::string HEXEncryption::encryptSecure(const SecureString& input) const {
+    std::string output(input.size() * 2, '\0');
+    EncodeTo(input.data(), input.size(), output.data());
+    return output;
+}
+
+bool HEXEncryption::decryptSecure(const std::string& input, SecureString& output) const {
+    // Decode straight into the secure string, no plaintext copy is left in regular memory
+    output.resize(input.length() / 2);
+    return DecodeTo(input.data(), input.size(), output.data());
+}
+
+void HEXEncryption::encryptBatch(const std::string_view* inputs, size_t count, std::string& arena, std::vector<size_t>& offsets) const {
+    EncodeBatchTo(inputs, count, arena, offsets);
+}
+
+bool HEXEncryption::decryptBatch(const std::string_view* inputs, size_t count, SecureString& arena, std::vector<size_t>& offsets) const {
+    return DecodeBatchTo(inputs, count, arena, offsets);
 }
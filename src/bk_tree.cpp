@@ -0,0 +1,131 @@
+/******************************************************************************
+ * Project: Password Manager - Console App
+ * File: bk_tree.cpp
+ * Description:
+ *   A Burkhard-Keller tree over app names, used to suggest the closest names
+ *   when a lookup does not match exactly ("did you mean").
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.2.0
+ * Author: Ghost
+ * Created On: 10-19-2026
+ * Last Modified: 10-19-2026
+ *****************************************************************************/
+
+#include "../include/bk_tree.h"
+#include <algorithm>
+#include <cctype>
+
+uint32_t BKTree::Distance(const std::string& a, const std::string& b) {
+    // Two row dynamic programming, thread_local so repeated calls don't allocate
+    thread_local std::vector<uint32_t> previous, current;
+    previous.resize(b.size() + 1);
+    current.resize(b.size() + 1);
+
+    for (uint32_t j = 0; j <= b.size(); ++j) previous[j] = j;
+
+    for (size_t i = 0; i < a.size(); ++i) {
+        current[0] = static_cast<uint32_t>(i + 1);
+        int ca = std::tolower(static_cast<unsigned char>(a[i]));
+        for (size_t j = 0; j < b.size(); ++j) {
+            uint32_t cost = ca == std::tolower(static_cast<unsigned char>(b[j])) ? 0 : 1;
+            current[j + 1] = std::min({ previous[j + 1] + 1, current[j] + 1, previous[j] + cost });
+        }
+        std::swap(previous, current);
+    }
+    return previous[b.size()];
+}
+
+void BKTree::Insert(const std::string& word) {
+    if (m_Nodes.empty()) {
+        m_Nodes.push_back({ word, 0, NO_NODE, NO_NODE, false });
+        return;
+    }
+
+    uint32_t node = 0;
+    while (true) {
+        if (m_Nodes[node].word == word) { // already indexed, revive it if it was removed
+            if (m_Nodes[node].deleted) {
+                m_Nodes[node].deleted = false;
+                m_DeletedCount--;
+            }
+            return;
+        }
+
+        uint32_t distance = Distance(word, m_Nodes[node].word);
+        uint32_t child = m_Nodes[node].firstChild;
+        while (child != NO_NODE && m_Nodes[child].distanceToParent != distance) child = m_Nodes[child].nextSibling;
+
+        if (child == NO_NODE) { // no child at this distance yet, attach a new one
+            m_Nodes.push_back({ word, distance, NO_NODE, m_Nodes[node].firstChild, false });
+            m_Nodes[node].firstChild = static_cast<uint32_t>(m_Nodes.size() - 1);
+            return;
+        }
+        node = child;
+    }
+}
+
+bool BKTree::Remove(const std::string& word) {
+    uint32_t node = FindNode(word);
+    if (node == NO_NODE) return false;
+
+    m_Nodes[node].deleted = true;
+    if (++m_DeletedCount > m_Nodes.size() / 2) Rebuild();
+    return true;
+}
+
+std::vector<std::string> BKTree::Search(const std::string& query, uint32_t maxDistance, size_t maxResults) const {
+    std::vector<std::pair<uint32_t, const std::string*>> matches;
+    if (m_Nodes.empty()) return {};
+
+    std::vector<uint32_t> pending{ 0 };
+    while (!pending.empty()) {
+        uint32_t node = pending.back();
+        pending.pop_back();
+
+        uint32_t distance = Distance(query, m_Nodes[node].word);
+        if (distance <= maxDistance && !m_Nodes[node].deleted) matches.emplace_back(distance, &m_Nodes[node].word);
+
+        // Only children in [distance - maxDistance, distance + maxDistance] can hold matches
+        uint32_t low = distance > maxDistance ? distance - maxDistance : 0;
+        uint32_t high = distance + maxDistance;
+        for (uint32_t child = m_Nodes[node].firstChild; child != NO_NODE; child = m_Nodes[child].nextSibling) {
+            if (m_Nodes[child].distanceToParent >= low && m_Nodes[child].distanceToParent <= high) pending.push_back(child);
+        }
+    }
+
+    std::sort(matches.begin(), matches.end(), [](const auto& a, const auto& b) {
+        return a.first != b.first ? a.first < b.first : *a.second < *b.second;
+    });
+
+    std::vector<std::string> results;
+    for (size_t i = 0; i < matches.size() && i < maxResults; ++i) results.push_back(*matches[i].second);
+    return results;
+}
+
+uint32_t BKTree::FindNode(const std::string& word) const {
+    if (m_Nodes.empty()) return NO_NODE;
+
+    uint32_t node = 0;
+    while (m_Nodes[node].word != word) {
+        uint32_t distance = Distance(word, m_Nodes[node].word);
+        uint32_t child = m_Nodes[node].firstChild;
+        while (child != NO_NODE && m_Nodes[child].distanceToParent != distance) child = m_Nodes[child].nextSibling;
+        if (child == NO_NODE) return NO_NODE;
+        node = child;
+    }
+    return m_Nodes[node].deleted ? NO_NODE : node;
+}
+
+void BKTree::Rebuild() {
+    std::vector<Node> nodes;
+    nodes.swap(m_Nodes);
+    m_DeletedCount = 0;
+    for (auto& node : nodes) {
+        if (!node.deleted) Insert(node.word);
+    }
+}
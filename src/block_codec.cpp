@@ -0,0 +1,151 @@
+/******************************************************************************
+ * Project: Password Manager - Console App
+ * File: block_codec.cpp
+ * Description:
+ *   A small LZ77 style block compressor used to shrink vault files before
+ *   they are encrypted and written to disk.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.2.0
+ * Author: Ghost
+ * Created On: 10-19-2026
+ * Last Modified: 10-19-2026
+ *****************************************************************************/
+
+#include "../include/block_codec.h"
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#define BC_MIN_MATCH 4
+#define BC_MAX_OFFSET 0xFFFF
+#define BC_HASH_BITS 12
+
+static uint32_t Read32(const char* p) {
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value)); // memcpy avoids unaligned reads
+    return value;
+}
+
+static uint32_t HashSequence(uint32_t sequence) {
+    return (sequence * 2654435761u) >> (32 - BC_HASH_BITS); // Knuth multiplicative hash
+}
+
+// Writes the remainder of a length that did not fit into its 4 bit token field (255, 255, ..., rest).
+static void WriteLength(char*& op, size_t length) {
+    while (length >= 255) {
+        *op++ = static_cast<char>(255);
+        length -= 255;
+    }
+    *op++ = static_cast<char>(length);
+}
+
+static void WriteSequence(char*& op, const char* literals, size_t literalCount, size_t offset, size_t matchLength) {
+    size_t matchCode = matchLength - BC_MIN_MATCH;
+    unsigned char token = static_cast<unsigned char>(((literalCount < 15 ? literalCount : 15) << 4) | (matchCode < 15 ? matchCode : 15));
+
+    *op++ = static_cast<char>(token);
+    if (literalCount >= 15) WriteLength(op, literalCount - 15);
+    std::memcpy(op, literals, literalCount);
+    op += literalCount;
+    *op++ = static_cast<char>(offset & 0xFF);
+    *op++ = static_cast<char>(offset >> 8);
+    if (matchCode >= 15) WriteLength(op, matchCode - 15);
+}
+
+static void WriteLastLiterals(char*& op, const char* literals, size_t literalCount) {
+    *op++ = static_cast<char>((literalCount < 15 ? literalCount : 15) << 4);
+    if (literalCount >= 15) WriteLength(op, literalCount - 15);
+    std::memcpy(op, literals, literalCount);
+    op += literalCount;
+}
+
+// Reads a length extension, returns false if the input ends before the length is complete.
+static bool ReadLength(const unsigned char*& ip, const unsigned char* end, size_t& length) {
+    unsigned char byte;
+    do {
+        if (ip >= end) return false;
+        byte = *ip++;
+        length += byte;
+    } while (byte == 255);
+    return true;
+}
+
+size_t BlockCodec::MaxCompressedSize(size_t size) {
+    return size + size / 255 + 16; // worst case: incompressible data plus length bytes
+}
+
+size_t BlockCodec::MaxDecompressedSize(size_t size) {
+    return size * 255; // worst case: every byte a length extension worth 255 bytes
+}
+
+size_t BlockCodec::Compress(const char* src, size_t size, char* dst) {
+    char* op = dst;
+
+    // Positions are stored +1 so that 0 means "empty slot"
+    std::vector<uint32_t> table(static_cast<size_t>(1) << BC_HASH_BITS, 0);
+
+    size_t anchor = 0; // start of the pending literals
+    size_t ip = 0;
+
+    while (ip + BC_MIN_MATCH <= size) {
+        uint32_t sequence = Read32(src + ip);
+        uint32_t hash = HashSequence(sequence);
+        size_t candidate = table[hash];
+        table[hash] = static_cast<uint32_t>(ip + 1);
+
+        if (candidate != 0 && ip - (candidate - 1) <= BC_MAX_OFFSET && Read32(src + candidate - 1) == sequence) {
+            size_t ref = candidate - 1;
+            size_t length = BC_MIN_MATCH;
+            while (ip + length < size && src[ref + length] == src[ip + length]) length++;
+
+            WriteSequence(op, src + anchor, ip - anchor, ip - ref, length);
+            ip += length;
+            anchor = ip;
+        }
+        else ip++;
+    }
+
+    WriteLastLiterals(op, src + anchor, size - anchor);
+    return static_cast<size_t>(op - dst);
+}
+
+bool BlockCodec::Decompress(const char* src, size_t size, char* dst, size_t rawSize) {
+    const unsigned char* ip = reinterpret_cast<const unsigned char*>(src);
+    const unsigned char* end = ip + size;
+    size_t op = 0;
+
+    while (ip < end) {
+        unsigned char token = *ip++;
+
+        size_t literalCount = token >> 4;
+        if (literalCount == 15 && !ReadLength(ip, end, literalCount)) return false;
+        if (literalCount > static_cast<size_t>(end - ip) || literalCount > rawSize - op) return false;
+        std::memcpy(dst + op, ip, literalCount);
+        ip += literalCount;
+        op += literalCount;
+
+        if (ip == end) break; // last sequence only holds literals
+
+        if (end - ip < 2) return false;
+        size_t offset = ip[0] | (static_cast<size_t>(ip[1]) << 8);
+        ip += 2;
+        if (offset == 0 || offset > op) return false;
+
+        size_t matchLength = token & 0x0F;
+        if (matchLength == 15 && !ReadLength(ip, end, matchLength)) return false;
+        matchLength += BC_MIN_MATCH;
+        if (matchLength > rawSize - op) return false;
+
+        // Byte by byte copy since a match may overlap the bytes it is producing (e.g. "aaaa...")
+        const char* ref = dst + op - offset;
+        for (size_t i = 0; i < matchLength; ++i) dst[op + i] = ref[i];
+        op += matchLength;
+    }
+
+    return op == rawSize;
+}
@@ -0,0 +1,154 @@
+/******************************************************************************
+ * Project: Password Manager - Console App
+ * File: checksum.cpp
+ * Description:
+ *   CRC32C checksums used to detect damaged lines in vault files, with the
+ *   hardware CRC instruction when the CPU has one.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.2.0
+ * Author: Ghost
+ * Created On: 10-19-2026
+ * Last Modified: 10-19-2026
+ *****************************************************************************/
+
+#include "../include/checksum.h"
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define CHECKSUM_X86 1
+#include <nmmintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#define CHECKSUM_ARM 1
+#include <arm_acle.h>
+#endif
+
+#define CRC32C_POLY 0x82F63B78u // reversed Castagnoli polynomial
+
+using CrcFunction = uint32_t (*)(const char*, size_t, uint32_t);
+
+// 8 tables of 256 entries: table[k][b] is the CRC of byte b followed by k zero bytes.
+struct CrcTables {
+    uint32_t table[8][256];
+
+    CrcTables() {
+        for (uint32_t b = 0; b < 256; ++b) {
+            uint32_t crc = b;
+            for (int bit = 0; bit < 8; ++bit) crc = (crc >> 1) ^ (CRC32C_POLY & (0u - (crc & 1)));
+            table[0][b] = crc;
+        }
+        for (uint32_t b = 0; b < 256; ++b) {
+            for (int k = 1; k < 8; ++k) table[k][b] = (table[k - 1][b] >> 8) ^ table[0][table[k - 1][b] & 0xFF];
+        }
+    }
+};
+
+static uint32_t Crc32cSoftware(const char* data, size_t size, uint32_t crc) {
+    static const CrcTables tables;
+    const auto& t = tables.table;
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(data);
+
+    // Slicing by 8 reads the input as 64-bit words, this assumes a little endian target like every platform the project builds for
+    while (size >= 8) {
+        uint64_t word;
+        std::memcpy(&word, p, sizeof(word));
+        word ^= crc;
+        crc = t[7][word & 0xFF] ^ t[6][(word >> 8) & 0xFF] ^ t[5][(word >> 16) & 0xFF] ^ t[4][(word >> 24) & 0xFF] ^
+              t[3][(word >> 32) & 0xFF] ^ t[2][(word >> 40) & 0xFF] ^ t[1][(word >> 48) & 0xFF] ^ t[0][word >> 56];
+        p += 8;
+        size -= 8;
+    }
+    while (size--) crc = (crc >> 8) ^ t[0][(crc ^ *p++) & 0xFF];
+    return crc;
+}
+
+#ifdef CHECKSUM_X86
+#ifndef _MSC_VER
+__attribute__((target("sse4.2")))
+#endif
+static uint32_t Crc32cHardware(const char* data, size_t size, uint32_t crc) {
+    uint64_t crc64 = crc;
+    while (size >= 8) {
+        uint64_t word;
+        std::memcpy(&word, data, sizeof(word));
+        crc64 = _mm_crc32_u64(crc64, word);
+        data += 8;
+        size -= 8;
+    }
+    uint32_t crc32 = static_cast<uint32_t>(crc64);
+    while (size--) crc32 = _mm_crc32_u8(crc32, static_cast<unsigned char>(*data++));
+    return crc32;
+}
+
+static bool CpuHasSse42() {
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 1);
+    return (info[2] & (1 << 20)) != 0; // ECX bit 20
+#else
+    return __builtin_cpu_supports("sse4.2");
+#endif
+}
+#elif defined(CHECKSUM_ARM)
+static uint32_t Crc32cHardware(const char* data, size_t size, uint32_t crc) {
+    while (size >= 8) {
+        uint64_t word;
+        std::memcpy(&word, data, sizeof(word));
+        crc = __crc32cd(crc, word);
+        data += 8;
+        size -= 8;
+    }
+    while (size--) crc = __crc32cb(crc, static_cast<unsigned char>(*data++));
+    return crc;
+}
+#endif
+
+static CrcFunction SelectImplementation() {
+#ifdef CHECKSUM_X86
+    if (CpuHasSse42()) return Crc32cHardware;
+#elif defined(CHECKSUM_ARM)
+    return Crc32cHardware; // the build already requires the CRC extension
+#endif
+    return Crc32cSoftware;
+}
+
+static CrcFunction Implementation() {
+    static const CrcFunction function = SelectImplementation();
+    return function;
+}
+
+uint32_t Checksum::Crc32c(const char* data, size_t size, uint32_t crc) {
+    return ~Implementation()(data, size, ~crc);
+}
+
+bool Checksum::HasHardwareSupport() {
+    return Implementation() != Crc32cSoftware;
+}
+
+void Checksum::Format(uint32_t crc, char* output) {
+    for (int i = 0; i < CHECKSUM_DIGITS; ++i) {
+        unsigned char nibble = (crc >> (28 - i * 4)) & 0x0F;
+        output[i] = static_cast<char>('0' + nibble + (nibble > 9) * 7);
+    }
+}
+
+bool Checksum::Parse(const char* input, size_t size, uint32_t& crc) {
+    if (size != CHECKSUM_DIGITS) return false;
+    crc = 0;
+    for (size_t i = 0; i < size; ++i) {
+        char c = input[i];
+        uint32_t nibble;
+        if (c >= '0' && c <= '9') nibble = c - '0';
+        else if (c >= 'A' && c <= 'F') nibble = c - 'A' + 10;
+        else return false;
+        crc = (crc << 4) | nibble;
+    }
+    return true;
+}
@@ -9,16 +9,193 @@
  * This source code is licensed under the MIT License. For more details, see
  * the LICENSE file in the root directory of this project.
  *
- * Version: v1.1.0
+ * Version: v1.2.0
  * Author: Ghost
  * Created On: 1-28-2025
- * Last Modified: 02-06-2025
+ * Last Modified: 10-19-2026
  *****************************************************************************/
 
 #include "../include/custom_io.h"
+#include "../include/checksum.h"
+#include "../include/cipher_pipeline.h"
+#include "../include/HexE.h"
+#include "../include/logger.h"
+#include "../include/vault_index.h"
 #include <fstream>
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <exception>
+#include <string_view>
+#include <thread>
+#include <vector>
 
 #define ENCRYPT_DELIM "|"
+#define FIO_WRITE_BUFFER (256 * 1024) // bytes of encoded lines gathered before each write to the file
+#define FIO_BATCH_RECORDS 1024        // records handed to the encryption module per batch call
+
+// Records decoded from one compressed block, in file order.
+using BlockRecords = SecureVector<std::pair<std::string, SecureString>>; // short passwords sit inline
+
+// Appends a 32-bit little endian length, used to frame records inside a compressed block.
+static void AppendLength(SecureString& out, size_t length) {
+    for (int i = 0; i < 4; ++i) out.push_back(static_cast<char>((length >> (i * 8)) & 0xFF));
+}
+
+static bool ReadLength(const SecureString& in, size_t& pos, size_t& length) {
+    if (in.size() - pos < 4) return false;
+    length = 0;
+    for (int i = 0; i < 4; ++i) length |= static_cast<size_t>(static_cast<unsigned char>(in[pos + i])) << (i * 8);
+    pos += 4;
+    return true;
+}
+
+// Ends the line started at `lineStart` with its checksum: |<CRC32C of the line>
+static void AppendChecksum(std::string& out, size_t lineStart) {
+    uint32_t crc = Checksum::Crc32c(out.data() + lineStart, out.size() - lineStart);
+    out += ENCRYPT_DELIM;
+    size_t pos = out.size();
+    out.resize(pos + CHECKSUM_DIGITS);
+    Checksum::Format(crc, &out[pos]);
+}
+
+// Skips the FIO_FORMAT_LINE line at the start of a vault, returns true if it was there: every
+// line of the vault then has a checksum.
+static bool ReadFormatLine(std::string_view& contents) {
+    std::string_view format(FIO_FORMAT_LINE "\n");
+    if (contents.substr(0, format.size()) != format) return false;
+    contents.remove_prefix(format.size());
+    return true;
+}
+
+// Same for a file, the stream is left after the format line, or at the start without one.
+static bool ReadFormatLine(std::istream& file) {
+    std::string_view format(FIO_FORMAT_LINE "\n");
+    std::string start(format.size(), '\0');
+    bool present = file.read(start.data(), static_cast<std::streamsize>(start.size())) && start == format;
+    file.clear();
+    file.seekg(present ? static_cast<std::streamoff>(format.size()) : 0);
+    return present;
+}
+
+// Checks the layout and checksum of a non-empty line, and strips the checksum off it.
+// Returns nullptr if the line is usable, the reason it is damaged otherwise. `checked` is set
+// when the line has a checksum, lines written before checksums existed have none: that is only
+// accepted in a vault without the format line (`required` not set).
+static const char* CheckLine(std::string_view& line, bool& checked, bool required) {
+    bool block = line[0] == FIO_BLOCK_TAG || line[0] == FIO_META_TAG || line[0] == FIO_META_PATCH_TAG;
+    size_t fields = block ? 3 : line[0] == FIO_REMOVE_TAG ? 1 : 2; // ~count|rawSize|payload, -name or name|password
+    size_t delimiters = static_cast<size_t>(std::count(line.begin(), line.end(), ENCRYPT_DELIM[0]));
+    checked = delimiters == fields;
+    if (delimiters + 1 == fields) return required ? "missing checksum" : nullptr;
+    if (delimiters + 1 < fields) return "missing delimiter";
+    if (!checked) return "too many delimiters";
+
+    uint32_t stored;
+    size_t checksumPos = line.size() - CHECKSUM_DIGITS;
+    if (line.size() <= CHECKSUM_DIGITS || line[checksumPos - 1] != ENCRYPT_DELIM[0] ||
+        !Checksum::Parse(line.data() + checksumPos, CHECKSUM_DIGITS, stored)) return "malformed checksum";
+    line.remove_suffix(CHECKSUM_DIGITS + 1);
+    if (Checksum::Crc32c(line.data(), line.size()) != stored) return "checksum mismatch";
+    return nullptr;
+}
+
+// Compresses and encrypts one block into a single line: <tag><count>|<rawSize>|<payload>|<checksum>
+// The block is either framed records (FIO_BLOCK_TAG) or the entry metadata columns (FIO_META_TAG).
+template <typename Codec>
+static void AppendBlock(std::string& out, const SecureString& block, size_t count, const CipherPipeline<CompressStage, Codec>& pipeline, char tag = FIO_BLOCK_TAG) {
+    size_t lineStart = out.size();
+    out += tag;
+    out.append(std::to_string(count)).append(ENCRYPT_DELIM).append(std::to_string(block.size())).append(ENCRYPT_DELIM);
+    pipeline.Encode(block.data(), block.size(), out);
+    AppendChecksum(out, lineStart);
+    out += '\n';
+}
+
+// Decrypts and decompresses the payload of a block line (checksum already stripped), returns false if it is damaged.
+template <typename Codec>
+static bool ReadBlockPayload(std::string_view line, const Codec& codec, SecureString& block, size_t& count) {
+    const char* begin = line.data() + 1; // skip the tag
+    const char* end = line.data() + line.size();
+    size_t rawSize = 0;
+
+    auto [countEnd, countErr] = std::from_chars(begin, end, count);
+    if (countErr != std::errc() || countEnd == end || *countEnd != ENCRYPT_DELIM[0]) return false;
+    auto [sizeEnd, sizeErr] = std::from_chars(countEnd + 1, end, rawSize);
+    if (sizeErr != std::errc() || sizeEnd == end || *sizeEnd != ENCRYPT_DELIM[0]) return false;
+
+    CipherPipeline<CompressStage, Codec> pipeline(CompressStage{ rawSize }, codec);
+    return pipeline.Decode(sizeEnd + 1, static_cast<size_t>(end - sizeEnd - 1), block);
+}
+
+// Applies a metadata line (checksum already stripped): the whole table (FIO_META_TAG) replaces
+// `metadata`, appended rows (FIO_META_PATCH_TAG) replace the rows of their names. Returns false if it is damaged.
+template <typename Codec>
+static bool ReadMetadataLine(std::string_view line, const Codec& codec, EntryMetadata& metadata) {
+    SecureString columns;
+    size_t rows = 0;
+    if (!ReadBlockPayload(line, codec, columns, rows)) return false;
+    if (line[0] == FIO_META_TAG) return metadata.Deserialize(columns.data(), columns.size());
+
+    EntryMetadata patch;
+    if (!patch.Deserialize(columns.data(), columns.size())) return false;
+    metadata.Patch(patch);
+    return true;
+}
+
+// Decodes the framed records of one block line, returns false if the block is damaged.
+template <typename Codec>
+static bool ReadBlock(std::string_view line, const Codec& codec, BlockRecords& records) {
+    SecureString block;
+    size_t count = 0;
+    if (!ReadBlockPayload(line, codec, block, count)) return false;
+
+    size_t pos = 0;
+    records.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        size_t appLength, passLength;
+        if (!ReadLength(block, pos, appLength) || !ReadLength(block, pos, passLength)) return false;
+        if (block.size() - pos < appLength + passLength) return false;
+        records.emplace_back(std::string(block.data() + pos, appLength), SecureString(block.data() + pos + appLength, passLength));
+        pos += appLength + passLength;
+    }
+    return pos == block.size();
+}
+
+// Checks and decodes every block, spreading them across the available hardware threads.
+// Returns the number of damaged blocks, which are dropped like damaged lines. A block whose
+// decoding throws (e.g. out of memory) is damaged as well, an exception must not leave a worker.
+template <typename Codec>
+static size_t ReadBlocks(const std::vector<std::string_view>& blocks, const Codec& codec, PasswordMap& passwords, bool checksummed) {
+    std::vector<BlockRecords> decoded(blocks.size());
+    std::vector<char> damaged(blocks.size(), 0);
+    size_t threadCount = std::min<size_t>(blocks.size(), std::max(1u, std::thread::hardware_concurrency()));
+
+    auto worker = [&](size_t first) {
+        for (size_t i = first; i < blocks.size(); i += threadCount) {
+            std::string_view line = blocks[i];
+            bool checked, usable = false;
+            try {
+                usable = CheckLine(line, checked, checksummed) == nullptr && ReadBlock(line, codec, decoded[i]);
+            }
+            catch (const std::exception&) {}
+            if (!usable) {
+                decoded[i].clear();
+                damaged[i] = 1;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t t = 1; t < threadCount; ++t) threads.emplace_back(worker, t);
+    worker(0); // the calling thread takes a share of the work as well
+    for (auto& thread : threads) thread.join();
+
+    for (auto& records : decoded) {
+        for (auto& [app, pass] : records) passwords[std::move(app)] = std::move(pass);
+    }
+    return static_cast<size_t>(std::count(damaged.begin(), damaged.end(), 1));
+}
 
 void CustomIO::PrintToScreen(const char* msg, bool lineBreak) {
     if (lineBreak) std::cout << msg << std::endl;
@@ -75,36 +252,551 @@ std::filesystem::path CustomIO::GetSavePath(const std::string& filename) {
     return (std::filesystem::path(GetExecutablePath()) / (filename + FIO_EXT));
 }
 
-bool CustomIO::SaveToFile(const std::unordered_map<std::string, std::string>& passwords, const std::filesystem::path& savePath, const IEncryption& encrypt) {
+std::filesystem::path CustomIO::GetIndexPath(const std::filesystem::path& savePath) {
+    return std::filesystem::path(savePath).replace_extension(FIO_INDEX_EXT);
+}
+
+bool CustomIO::SaveToFile(const PasswordMap& passwords, const std::filesystem::path& savePath, const IEncryption& encrypt, bool compress, const EntryMetadata* metadata) {
+    // Use the inlined path when the concrete type is known, the virtual interface otherwise
+    if (const HEXEncryption* hexEncrypt = dynamic_cast<const HEXEncryption*>(&encrypt)) {
+        return SaveToFileAs(passwords, savePath, *hexEncrypt, compress, metadata);
+    }
+    return SaveToFileAs(passwords, savePath, encrypt, compress, metadata);
+}
+
+template <typename Encryption>
+bool CustomIO::SaveToFileAs(const PasswordMap& passwords, const std::filesystem::path& savePath, const Encryption& encrypt, bool compress, const EntryMetadata* metadata) {
     
     std::ofstream file(savePath, std::ios::binary | std::ios::trunc);
     if (file.is_open()) {
-        for (const auto& [app, pass] : passwords) {
-            file << encrypt.encrypt(app) << ENCRYPT_DELIM << encrypt.encrypt(pass) << "\n";
+        auto codec = MakeStage(encrypt);
+        std::vector<IndexEntry> index;
+        index.reserve(passwords.size());
+        uint64_t offset = 0; // byte offset of the next line, recorded in the index
+        std::string out;     // encoded lines waiting to be written
+        out.reserve(FIO_WRITE_BUFFER + 4096);
+        AppendFormatLine(out);
+
+        auto flush = [&](bool force) {
+            if (force || out.size() >= FIO_WRITE_BUFFER) {
+                file.write(out.data(), static_cast<std::streamsize>(out.size()));
+                offset += out.size();
+                out.clear();
+            }
+        };
+
+        // Fields are encrypted FIO_BATCH_RECORDS records at a time, one call per batch
+        std::vector<std::string_view> fields;
+        std::string arena;
+        std::vector<size_t> arenaOffsets;
+        fields.reserve(FIO_BATCH_RECORDS * 2);
+
+        if (compress) {
+            CipherPipeline<CompressStage, decltype(codec)> pipeline(CompressStage{}, codec);
+            SecureString block;
+            size_t count = 0;
+            block.reserve(FIO_BLOCK_SIZE + 256);
+
+            // Only the names are encrypted on their own, for the index
+            auto appendBlock = [&]() {
+                codec.EncodeBatch(fields.data(), fields.size(), arena, arenaOffsets);
+                uint64_t blockOffset = offset + out.size(); // offset of the block every record lands in
+                for (size_t i = 0; i < fields.size(); ++i) {
+                    index.push_back({ VaultIndex::HashKey(std::string_view(arena).substr(arenaOffsets[i], arenaOffsets[i + 1] - arenaOffsets[i])), blockOffset });
+                }
+                AppendBlock(out, block, count, pipeline);
+                flush(false);
+                fields.clear();
+                block.clear();
+                count = 0;
+            };
+
+            for (const auto& [app, pass] : passwords) {
+                AppendLength(block, app.size());
+                AppendLength(block, pass.size());
+                block.append(app).append(pass.data(), pass.size());
+                fields.push_back(app);
+                count++;
+                if (block.size() >= FIO_BLOCK_SIZE) appendBlock();
+            }
+            if (count > 0) appendBlock();
+        }
+        else {
+            auto it = passwords.begin();
+            while (it != passwords.end()) {
+                fields.clear();
+                for (; it != passwords.end() && fields.size() < FIO_BATCH_RECORDS * 2; ++it) {
+                    fields.push_back(it->first);
+                    fields.emplace_back(it->second.data(), it->second.size());
+                }
+                codec.EncodeBatch(fields.data(), fields.size(), arena, arenaOffsets);
+
+                // Field 2i is a name, field 2i + 1 its password
+                for (size_t i = 0; i < fields.size(); i += 2) {
+                    std::string_view encryptedApp(arena.data() + arenaOffsets[i], arenaOffsets[i + 1] - arenaOffsets[i]);
+                    std::string_view encryptedPass(arena.data() + arenaOffsets[i + 1], arenaOffsets[i + 2] - arenaOffsets[i + 1]);
+                    size_t lineStart = out.size();
+                    index.push_back({ VaultIndex::HashKey(encryptedApp), offset + lineStart });
+                    out.append(encryptedApp).append(ENCRYPT_DELIM).append(encryptedPass);
+                    AppendChecksum(out, lineStart);
+                    out += '\n';
+                }
+                flush(false);
+            }
+        }
+        // The metadata columns compress well whether or not the records are compressed
+        if (metadata != nullptr && metadata->Size() > 0) {
+            CipherPipeline<CompressStage, decltype(codec)> pipeline(CompressStage{}, codec);
+            SecureString columns;
+            metadata->Serialize(columns);
+            AppendBlock(out, columns, metadata->Size(), pipeline, FIO_META_TAG);
         }
+        flush(true);
         file.close();
-        return true;
+
+        // The index is optional, a vault without a valid index is still read by a full load
+        std::filesystem::path indexPath = GetIndexPath(savePath);
+        if (!file || !VaultIndex::Write(indexPath, index, savePath, offset)) {
+            std::error_code error;
+            std::filesystem::remove(indexPath, error);
+        }
+        return static_cast<bool>(file);
     } 
 
     return false;
 }
 
-std::unordered_map<std::string, std::string> CustomIO::LoadFromFile(const std::filesystem::path& savePath, const IEncryption& encrypt) {
+bool CustomIO::AppendChanges(const std::filesystem::path& savePath, const std::vector<VaultChange>& changes, const IEncryption& encrypt, const EntryMetadata* metadata) {
+
+    std::error_code error;
+    uint64_t vaultSize = std::filesystem::file_size(savePath, error);
+    uint64_t indexedSize = 0;
+    std::filesystem::path indexPath = GetIndexPath(savePath);
+    if (error || vaultSize == 0 || !VaultIndex::ReadIndexedSize(indexPath, savePath, vaultSize, indexedSize)) return false;
+    if (!VaultIndex::IsCurrent(indexPath, savePath)) return false; // changed behind our back, a full write rebuilds the index
+
+    // A line cut short (e.g. by a crash during an earlier append) would swallow the first appended line
+    {
+        std::ifstream file(savePath, std::ios::binary);
+        char last = 0;
+        file.seekg(static_cast<std::streamoff>(vaultSize - 1));
+        if (!file.get(last) || last != '\n') return false;
+    }
+
+    // Names and passwords are encrypted in one batch: name and password for a change, the name only for a removal
+    std::vector<std::string_view> fields;
+    for (const VaultChange& change : changes) {
+        fields.push_back(change.app);
+        if (change.password != nullptr) fields.emplace_back(change.password->data(), change.password->size());
+    }
+    std::string arena;
+    std::vector<size_t> arenaOffsets;
+    encrypt.encryptBatch(fields.data(), fields.size(), arena, arenaOffsets);
+    auto field = [&](size_t i) { return std::string_view(arena.data() + arenaOffsets[i], arenaOffsets[i + 1] - arenaOffsets[i]); };
+
+    std::string out;
+    size_t next = 0;
+    for (const VaultChange& change : changes) {
+        if (change.password != nullptr) {
+            AppendRecordLine(out, field(next), field(next + 1));
+            next += 2;
+            continue;
+        }
+        size_t lineStart = out.size();
+        out += FIO_REMOVE_TAG;
+        out.append(field(next++));
+        AppendChecksum(out, lineStart);
+        out += '\n';
+    }
+    // Only the rows of the entries still present, a removal line drops the row of its entry
+    if (metadata != nullptr) {
+        EntryMetadata patch;
+        for (const VaultChange& change : changes) {
+            size_t row = change.password != nullptr ? metadata->Row(change.app) : EM_NO_ROW;
+            if (row != EM_NO_ROW) patch.CopyRow(*metadata, row);
+        }
+        if (patch.Size() > 0) AppendMetadataLine(out, patch, encrypt, FIO_META_PATCH_TAG);
+    }
+
+    if ((vaultSize - indexedSize + out.size()) * FIO_JOURNAL_MAX_RATIO > indexedSize) return false; // time to compact
+
+    std::ofstream file(savePath, std::ios::binary | std::ios::app);
+    if (!file.is_open()) return false;
+    file.write(out.data(), static_cast<std::streamsize>(out.size()));
+    file.close();
+    if (!file) return false;
+    VaultIndex::Refresh(indexPath, savePath); // the index still describes the vault, appended lines are not indexed
+    return true;
+}
+
+std::string CustomIO::ReadFile(const std::filesystem::path& savePath) {
 
-    std::unordered_map<std::string, std::string> passwords({});
+    std::string contents;
     std::ifstream file(savePath, std::ios::binary);
 
     if (file.is_open()) {
-        std::string line;
-        while (std::getline(file, line)) {
-            size_t delimiterPos = line.find(ENCRYPT_DELIM);
-            if (delimiterPos != std::string::npos) {
-                std::string app = line.substr(0, delimiterPos);
-                std::string pass = line.substr(delimiterPos + 1);
-                passwords[encrypt.decrypt(app)] = encrypt.decrypt(pass);
-            }
+        std::error_code error;
+        uintmax_t size = std::filesystem::file_size(savePath, error);
+        if (!error) {
+            contents.resize(static_cast<size_t>(size));
+            file.read(contents.data(), static_cast<std::streamsize>(size));
+            contents.resize(static_cast<size_t>(file.gcount()));
         }
         file.close();
     }
+    return contents;
+}
+
+PasswordMap CustomIO::ParseVault(const std::string& contents, const IEncryption& encrypt, EntryMetadata* metadata) {
+    if (const HEXEncryption* hexEncrypt = dynamic_cast<const HEXEncryption*>(&encrypt)) {
+        return ParseVaultAs(contents, *hexEncrypt, metadata);
+    }
+    return ParseVaultAs(contents, encrypt, metadata);
+}
+
+template <typename Encryption>
+PasswordMap CustomIO::ParseVaultAs(const std::string& contents, const Encryption& encrypt, EntryMetadata* metadata) {
+
+    auto codec = MakeStage(encrypt);
+    PasswordMap passwords({});
+    std::vector<std::string_view> blocks;
+    if (metadata != nullptr) *metadata = EntryMetadata();
+    std::string_view remaining(contents);
+    bool checksummed = ReadFormatLine(remaining);
+
+    // Record fields are gathered and decrypted FIO_BATCH_RECORDS records at a time
+    std::vector<std::string_view> fields;
+    SecureString arena, scratch;
+    std::vector<size_t> arenaOffsets;
+    size_t damaged = 0;
+    fields.reserve(FIO_BATCH_RECORDS * 2);
+
+    auto decodes = [&](std::string_view field) {
+        scratch.clear();
+        return codec.Decode(field.data(), field.size(), scratch);
+    };
+
+    auto readBlocks = [&]() {
+        damaged += ReadBlocks(blocks, codec, passwords, checksummed);
+        blocks.clear();
+    };
+
+    auto decodeFields = [&]() {
+        bool valid = codec.DecodeBatch(fields.data(), fields.size(), arena, arenaOffsets);
+        for (size_t i = 0; i < fields.size(); i += 2) {
+            // Rare path: the batch held a field the module rejected, find out which record it was
+            if (!valid && !(decodes(fields[i]) && decodes(fields[i + 1]))) {
+                damaged++;
+                continue;
+            }
+            std::string app(arena.data() + arenaOffsets[i], arenaOffsets[i + 1] - arenaOffsets[i]);
+            // A repeated name keeps the last password, as before
+            passwords[std::move(app)].assign(arena.data() + arenaOffsets[i + 1], arenaOffsets[i + 2] - arenaOffsets[i + 1]);
+        }
+        fields.clear();
+    };
+
+    while (!remaining.empty()) {
+        size_t lineEnd = remaining.find('\n');
+        std::string_view line = remaining.substr(0, lineEnd);
+        remaining.remove_prefix(lineEnd == std::string_view::npos ? remaining.size() : lineEnd + 1);
+
+        if (line.empty()) continue;
+        // Lines apply in file order, so whatever is pending is decoded before a line of another kind
+        if (line[0] == FIO_BLOCK_TAG) { // consecutive compressed blocks are checked and decoded in parallel
+            if (!fields.empty()) decodeFields();
+            blocks.push_back(line);
+            continue;
+        }
+        if (line[0] == FIO_META_TAG || line[0] == FIO_META_PATCH_TAG) {
+            if (metadata == nullptr) continue;
+            bool checked;
+            if (CheckLine(line, checked, checksummed) != nullptr || !ReadMetadataLine(line, codec, *metadata)) damaged++;
+            continue;
+        }
+        bool checked;
+        if (CheckLine(line, checked, checksummed) != nullptr) {
+            damaged++;
+            continue;
+        }
+        if (!blocks.empty()) readBlocks();
+        if (line[0] == FIO_REMOVE_TAG) { // an appended removal, see AppendChanges
+            if (!fields.empty()) decodeFields();
+            if (!decodes(line.substr(1))) {
+                damaged++;
+                continue;
+            }
+            std::string app(scratch.data(), scratch.size());
+            passwords.erase(app);
+            if (metadata != nullptr) metadata->Remove(app);
+            continue;
+        }
+        size_t delimiterPos = line.find(ENCRYPT_DELIM);
+        fields.push_back(line.substr(0, delimiterPos));
+        fields.push_back(line.substr(delimiterPos + 1));
+        if (fields.size() >= FIO_BATCH_RECORDS * 2) decodeFields();
+    }
+    if (!fields.empty()) decodeFields();
+    if (!blocks.empty()) readBlocks();
+
+    if (damaged > 0) {
+        std::string warning = std::to_string(damaged) + " damaged line(s) in the vault were skipped, run with --verify for details.";
+        Logger::Warning(warning.c_str());
+    }
     return passwords;
 }
+
+// Explicit instantiations: the inlined HEX path and the virtual fallback for any other IEncryption.
+// A new encryption module gets its own fast path by adding a `MakeStage` overload and a line here.
+template bool CustomIO::SaveToFileAs<HEXEncryption>(const PasswordMap&, const std::filesystem::path&, const HEXEncryption&, bool, const EntryMetadata*);
+template bool CustomIO::SaveToFileAs<IEncryption>(const PasswordMap&, const std::filesystem::path&, const IEncryption&, bool, const EntryMetadata*);
+template PasswordMap CustomIO::ParseVaultAs<HEXEncryption>(const std::string&, const HEXEncryption&, EntryMetadata*);
+template PasswordMap CustomIO::ParseVaultAs<IEncryption>(const std::string&, const IEncryption&, EntryMetadata*);
+
+PasswordMap CustomIO::LoadFromFile(const std::filesystem::path& savePath, const IEncryption& encrypt, EntryMetadata* metadata) {
+    return ParseVault(ReadFile(savePath), encrypt, metadata);
+}
+
+bool CustomIO::FindInFile(const std::filesystem::path& savePath, const std::string& app, const IEncryption& encrypt, SecureString& pass) {
+
+    std::error_code error;
+    uint64_t vaultSize = std::filesystem::file_size(savePath, error);
+    if (error) return false; // no vault, nothing to find
+
+    // Without an index that can be trusted, fall back to a full load
+    auto findByLoading = [&]() {
+        auto passwords = LoadFromFile(savePath, encrypt);
+        auto it = passwords.find(app);
+        if (it == passwords.end()) return false;
+        pass = std::move(it->second);
+        return true;
+    };
+
+    VaultIndex index;
+    if (!index.Open(GetIndexPath(savePath), savePath, vaultSize)) return findByLoading();
+
+    std::string encryptedApp = encrypt.encrypt(app);
+    uint64_t hash = VaultIndex::HashKey(encryptedApp);
+    std::ifstream file(savePath, std::ios::binary);
+    std::string line;
+    bool found = false;
+    bool checksummed = ReadFormatLine(file);
+
+    // A repeated name keeps its last password, as when loading: the candidate at the highest offset wins
+    std::vector<uint64_t> offsets;
+    if (index.MayContain(hash)) index.FindOffsets(hash, offsets);
+    std::sort(offsets.begin(), offsets.end(), std::greater<uint64_t>());
+    // "Not present" is only trusted from an index as recent as the vault: an edit in the middle of the
+    // indexed part that keeps the size passes the fingerprint, but not the modification times
+    if (offsets.empty() && !index.IsCurrent()) return findByLoading();
+    // Every candidate must start a line holding the name, anything else means the index does not
+    // describe this file after all (or a 64-bit hash collision), the full load settles it
+    for (size_t i = 0; i < offsets.size() && !found; ++i) {
+        char previous = '\n';
+        file.clear();
+        if (offsets[i] > 0) file.seekg(static_cast<std::streamoff>(offsets[i] - 1)).get(previous);
+        else file.seekg(0);
+        if (offsets[i] >= index.IndexedSize() || previous != '\n' || !std::getline(file, line) || line.empty()) return findByLoading();
+
+        std::string_view view(line);
+        bool checked;
+        if (CheckLine(view, checked, checksummed) != nullptr) return findByLoading();
+
+        if (view[0] == FIO_BLOCK_TAG) {
+            BlockRecords records;
+            if (!ReadBlock(view, MakeStage(encrypt), records)) return findByLoading();
+            for (auto it = records.rbegin(); it != records.rend() && !found; ++it) { // the last one in the block
+                if (it->first == app) {
+                    pass = std::move(it->second);
+                    found = true;
+                }
+            }
+        }
+        else {
+            // Compare the encrypted names so only the matching password gets decrypted
+            size_t delimiterPos = view.find(ENCRYPT_DELIM);
+            if (delimiterPos != encryptedApp.size() || view.compare(0, delimiterPos, encryptedApp) != 0) return findByLoading();
+            found = encrypt.decryptSecure(std::string(view.substr(delimiterPos + 1)), pass);
+        }
+        if (!found) return findByLoading();
+    }
+
+    // Changes appended after the indexed part are not indexed, read them in order, the last one wins
+    if (index.IndexedSize() < vaultSize) {
+        file.clear();
+        file.seekg(static_cast<std::streamoff>(index.IndexedSize()));
+        while (std::getline(file, line)) {
+            if (line.empty() || line[0] == FIO_META_TAG || line[0] == FIO_META_PATCH_TAG || line[0] == FIO_BLOCK_TAG) continue;
+            std::string_view view(line);
+            bool checked;
+            if (CheckLine(view, checked, checksummed) != nullptr) continue;
+
+            bool removal = view[0] == FIO_REMOVE_TAG;
+            if (removal) view.remove_prefix(1);
+            size_t delimiterPos = removal ? view.size() : view.find(ENCRYPT_DELIM);
+            if (view.substr(0, delimiterPos) != encryptedApp) continue;
+            found = !removal && encrypt.decryptSecure(std::string(view.substr(delimiterPos + 1)), pass);
+        }
+    }
+
+    if (!found) { // the entry may have been found, then removed later
+        SecurePool::Wipe(pass.data(), pass.size());
+        pass.clear();
+    }
+    return found;
+}
+
+bool CustomIO::ScanFile(const std::filesystem::path& savePath, const IEncryption& encrypt, const std::function<void(const EncryptedRecord&)>& visit,
+    EntryMetadata* metadata, size_t* damaged) {
+
+    std::ifstream file(savePath, std::ios::binary);
+    if (!file.is_open()) return false;
+
+    auto codec = MakeStage(encrypt);
+    if (metadata != nullptr) *metadata = EntryMetadata();
+    size_t damagedLines = 0;
+    bool checksummed = ReadFormatLine(file);
+    uint64_t offset = static_cast<uint64_t>(file.tellg());
+    std::string line, arena;
+    std::vector<size_t> arenaOffsets;
+    std::vector<std::string_view> fields;
+
+    while (std::getline(file, line)) {
+        uint64_t lineOffset = offset;
+        offset += line.size() + 1;
+        if (line.empty()) continue;
+
+        std::string_view view(line);
+        bool isMetadata = view[0] == FIO_META_TAG || view[0] == FIO_META_PATCH_TAG;
+        bool isRemoval = view[0] == FIO_REMOVE_TAG; // removes a row of the metadata as well
+        bool wanted = isMetadata ? metadata != nullptr : visit || (isRemoval && metadata != nullptr);
+        if (!wanted) continue; // not even checked
+
+        bool checked;
+        if (CheckLine(view, checked, checksummed) != nullptr) {
+            damagedLines++;
+            continue;
+        }
+
+        if (isMetadata) {
+            if (!ReadMetadataLine(view, codec, *metadata)) damagedLines++;
+        }
+        else if (view[0] == FIO_BLOCK_TAG) {
+            BlockRecords records;
+            if (!ReadBlock(view, codec, records)) {
+                damagedLines++;
+                continue;
+            }
+            fields.clear();
+            for (const auto& [app, pass] : records) {
+                fields.push_back(app);
+                fields.emplace_back(pass.data(), pass.size());
+            }
+            codec.EncodeBatch(fields.data(), fields.size(), arena, arenaOffsets);
+            for (size_t i = 0; i < fields.size(); i += 2) {
+                visit({ std::string_view(arena.data() + arenaOffsets[i], arenaOffsets[i + 1] - arenaOffsets[i]),
+                        std::string_view(arena.data() + arenaOffsets[i + 1], arenaOffsets[i + 2] - arenaOffsets[i + 1]), lineOffset, false });
+            }
+        }
+        else if (isRemoval) {
+            if (metadata != nullptr) {
+                SecureString app;
+                if (codec.Decode(view.data() + 1, view.size() - 1, app)) metadata->Remove(std::string(app.data(), app.size()));
+            }
+            if (visit) visit({ view.substr(1), std::string_view(), lineOffset, true });
+        }
+        else {
+            size_t delimiterPos = view.find(ENCRYPT_DELIM);
+            visit({ view.substr(0, delimiterPos), view.substr(delimiterPos + 1), lineOffset, false });
+        }
+    }
+
+    if (damaged != nullptr) *damaged = damagedLines;
+    return true;
+}
+
+void CustomIO::AppendFormatLine(std::string& out) {
+    out.append(FIO_FORMAT_LINE).append("\n");
+}
+
+void CustomIO::AppendRecordLine(std::string& out, std::string_view encryptedApp, std::string_view encryptedPass) {
+    size_t lineStart = out.size();
+    out.append(encryptedApp).append(ENCRYPT_DELIM).append(encryptedPass);
+    AppendChecksum(out, lineStart);
+    out += '\n';
+}
+
+void CustomIO::AppendMetadataLine(std::string& out, const EntryMetadata& metadata, const IEncryption& encrypt, char tag) {
+    auto codec = MakeStage(encrypt);
+    CipherPipeline<CompressStage, decltype(codec)> pipeline(CompressStage{}, codec);
+    SecureString columns;
+    metadata.Serialize(columns);
+    AppendBlock(out, columns, metadata.Size(), pipeline, tag);
+}
+
+bool CustomIO::VerifyFile(const std::filesystem::path& savePath, VerifyReport& report) {
+
+    std::error_code error;
+    if (!std::filesystem::is_regular_file(savePath, error)) return false;
+    std::string contents = ReadFile(savePath);
+    std::string_view body(contents);
+    bool checksummed = ReadFormatLine(body);
+    size_t bodyStart = contents.size() - body.size();
+
+    // One range per thread, each range starts at the beginning of a line
+    size_t threadCount = std::max<size_t>(1, std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), contents.size() / FIO_WRITE_BUFFER));
+    std::vector<size_t> bounds(threadCount + 1, contents.size());
+    bounds[0] = bodyStart; // the format line is not counted as a checked line
+    for (size_t t = 1; t < threadCount; ++t) {
+        size_t lineEnd = contents.find('\n', contents.size() / threadCount * t - 1);
+        bounds[t] = std::min(lineEnd == std::string::npos ? contents.size() : lineEnd + 1, contents.size());
+    }
+
+    std::vector<VerifyReport> partial(threadCount);
+    std::vector<size_t> lineCounts(threadCount, 0); // every line of the range, empty ones included, to number lines
+
+    auto worker = [&](size_t t) {
+        std::string_view remaining(contents.data() + bounds[t], bounds[t + 1] - bounds[t]);
+        while (!remaining.empty()) {
+            uint64_t offset = static_cast<uint64_t>(remaining.data() - contents.data());
+            size_t lineEnd = remaining.find('\n');
+            std::string_view line = remaining.substr(0, lineEnd);
+            remaining.remove_prefix(lineEnd == std::string_view::npos ? remaining.size() : lineEnd + 1);
+            lineCounts[t]++;
+            if (line.empty()) continue;
+
+            size_t records = 1;
+            bool isMetadata = line[0] == FIO_META_TAG || line[0] == FIO_META_PATCH_TAG;
+            if (line[0] == FIO_BLOCK_TAG) { // the record count is in the header, readable without decrypting
+                std::from_chars_result result = std::from_chars(line.data() + 1, line.data() + line.size(), records);
+                if (result.ec != std::errc()) records = 0;
+            }
+            else if (isMetadata || line[0] == FIO_REMOVE_TAG) records = 0;
+
+            bool checked;
+            partial[t].lines++;
+            if (const char* reason = CheckLine(line, checked, checksummed)) partial[t].damaged.push_back({ lineCounts[t], offset, records, isMetadata, reason });
+            else if (!checked) partial[t].unchecked++;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t t = 1; t < threadCount; ++t) threads.emplace_back(worker, t);
+    worker(0);
+    for (auto& thread : threads) thread.join();
+
+    // Ranges numbered their lines from 1, shift them by the lines of the ranges before
+    size_t lineBase = bodyStart > 0 ? 1 : 0;
+    report = VerifyReport();
+    report.checksummed = checksummed;
+    for (size_t t = 0; t < threadCount; ++t) {
+        report.lines += partial[t].lines;
+        report.unchecked += partial[t].unchecked;
+        for (VaultDamage& damage : partial[t].damaged) {
+            damage.line += lineBase;
+            report.damaged.push_back(damage);
+        }
+        lineBase += lineCounts[t];
+    }
+    return true;
+}
@@ -9,13 +9,14 @@
  * This source code is licensed under the MIT License. For more details, see
  * the LICENSE file in the root directory of this project.
  *
- * Version: v1.0
+ * Version: v1.2.0
  * Author: Ghost
  * Created On: 1-28-2025
- * Last Modified: 1-29-2025
+ * Last Modified: 10-19-2026
  *****************************************************************************/
 
 #include "../include/custom_terminal.h"
+#include "../include/secure_allocator.h"
 #include <cstdlib> 
 
 // Static buffer to hold messages for printing.
@@ -30,8 +31,9 @@ void CustomTerminal::ClearTerminal() {
 }
 
 void CustomTerminal::PrintAndClearBuffer() {
-    for (const auto& message : BUFFER) {
+    for (auto& message : BUFFER) {
         std::cout << message;
+        SecurePool::Wipe(message); // messages may hold passwords (e.g. "View passwords")
     }
     BUFFER.clear();
 }
@@ -9,10 +9,10 @@
  * This source code is licensed under the MIT License. For more details, see
  * the LICENSE file in the root directory of this project.
  *
- * Version: v1.1.0
+ * Version: v1.2.0
  * Author: Ghost
  * Created On: 02-06-2025
- * Last Modified: 02-06-2025
+ * Last Modified: 10-19-2026
  *****************************************************************************/
 
 #include "driver.h"
@@ -21,12 +21,21 @@
 #include "custom_io.h"
 #include "custom_terminal.h"
 #include "HexE.h"
+#include "vault_cache.h"
+#include "vault_merge.h"
 #include <string>
 #include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <future>
+#include <iomanip>
+#include <iterator>
+#include <thread>
+#include <vector>
 
 #ifdef DEBUG // For Encrypted Password Viewer 
 #include <filesystem>
-#include <fstream>
 #endif
 
 /**
@@ -38,18 +47,61 @@ void displayMenu() {
  1. Add a password
  2. View passwords
  3. Delete a password
- 4. Exit
+ 4. Find a password
+ 5. Filter by tag or age
+ 6. Generate passwords
+ 7. Switch vault
+ 8. Exit
 )");
 }
 
-void runPasswordManager(const char* adminPassword) {
+/**
+ * @brief Reads the app names to generate passwords for.
+ * 
+ * @param input Comma separated names, or `@path` for a file with one name per line.
+ * @param apps Receives the trimmed, non-empty names.
+ * @return `false` if the file could not be read.
+ */
+static bool readAppNames(const std::string& input, std::vector<std::string>& apps) {
+    std::string names = input;
+    char separator = ',';
+    if (!input.empty() && input[0] == '@') {
+        std::ifstream file(input.substr(1), std::ios::binary);
+        if (!file.is_open()) return false;
+        names.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        separator = '\n';
+    }
+
+    size_t start = 0;
+    while (start < names.size()) {
+        size_t end = names.find(separator, start);
+        if (end == std::string::npos) end = names.size();
+        size_t first = names.find_first_not_of(" \t\r", start);
+        size_t last = names.find_last_not_of(" \t\r", end - 1);
+        if (first != std::string::npos && first < end && last >= first) apps.push_back(names.substr(first, last - first + 1));
+        start = end + 1;
+    }
+    return true;
+}
+
+void runPasswordManager(const char* adminPassword, const char* vault, bool showTiming) {
     
+    auto launchTime = std::chrono::steady_clock::now();
+
     // STACK VARIABLES
     std::string input;
     int choice;
     HEXEncryption hexEncrypt; // NOTE: If you decide on adding OpenSSL, create custom script and use Interface wrapped around library then swap it here
-    std::filesystem::path savePath = CustomIO::GetSavePath("passwords"); // NOTE: path to save data - you may change filename to whatever you like
-    PasswordManager manager(CustomIO::LoadFromFile(savePath, hexEncrypt));
+    std::filesystem::path savePath = VaultCache::ResolvePath(vault); // NOTE: default vault is "passwords" - you may change filename to whatever you like
+    bool compressVault = false; // NOTE: set to true to store the vault as compressed blocks - loading detects either format
+    VaultCache vaults(hexEncrypt, compressVault); // vaults opened from the menu stay unlocked until evicted
+
+    // Read the (still encrypted) vault on a background thread while the user types the master password.
+    // Nothing is decrypted until the user has been authenticated. The thread is detached: unlike the
+    // future of std::async, this future does not wait for the read when it is dropped after a failed login.
+    std::packaged_task<std::string()> readVault([path = savePath] { return CustomIO::ReadFile(path); });
+    std::future<std::string> vaultContents = readVault.get_future();
+    std::thread(std::move(readVault)).detach();
 
 #ifdef DEBUG // Encrypted Password Viewer 
     Logger::Info("***[DEBUG MODE]****************************");
@@ -79,6 +131,21 @@ void runPasswordManager(const char* adminPassword) {
     }
 #endif
 
+    auto loginTime = std::chrono::steady_clock::now();
+    EntryMetadata metadata;
+    PasswordMap passwords = CustomIO::ParseVault(vaultContents.get(), hexEncrypt, &metadata);
+    PasswordManager* manager = &vaults.Insert(savePath, std::move(passwords), std::move(metadata));
+
+    // Time to first menu, measured from login (what the user waits for) and from launch
+    auto readyTime = std::chrono::steady_clock::now();
+#ifdef DEBUG
+    showTiming = true;
+#endif
+    if (showTiming) {
+        CustomTerminal::AddMessageToBuffer("Startup: menu ready " + std::to_string(std::chrono::duration<double, std::milli>(readyTime - loginTime).count())
+            + " ms after login, " + std::to_string(std::chrono::duration<double, std::milli>(readyTime - launchTime).count()) + " ms after launch.", 2);
+    }
+
     // MAIN LOOP
     do {
         CustomTerminal::ClearTerminal();
@@ -88,41 +155,207 @@ void runPasswordManager(const char* adminPassword) {
 #endif
         
         CustomTerminal::PrintAndClearBuffer(); // display messages in buffer from last iteration
+        CustomIO::PrintToScreen(("Vault: " + savePath.string()).c_str(), true);
         displayMenu();
 
         choice = CustomIO::GetNumericInput();
         switch (choice) {
             case 1: {
-                std::string app, pass;
+                std::string app, pass, username, tags;
                 CustomIO::PrintToScreen("Enter the app/website name: ");
                 CustomIO::GetInputLine(app);
                 CustomIO::PrintToScreen("Enter the password: ");
                 CustomIO::GetInput(pass);
-                manager.AddPassword(app, pass);
+                CustomIO::PrintToScreen("Enter the username (optional): ");
+                CustomIO::GetInputLine(username);
+                CustomIO::PrintToScreen("Enter tags separated by commas (optional): ");
+                CustomIO::GetInputLine(tags);
+                manager->AddPassword(app, pass, username, tags);
+                SecurePool::Wipe(pass); // the manager keeps its own copy in secure memory
+                vaults.EvictOverLimit(); // the vault in use grew, other open vaults may have to close
                 break;
             }
             case 2: {
-                manager.ViewPasswords();
+                manager->ViewPasswords();
                 break;
             }
             case 3: {
                 std::string app;
                 CustomIO::PrintToScreen("Enter the app/website name to delete: ");
                 CustomIO::GetInputLine(app);
-                manager.DeletePassword(app);
+                manager->DeletePassword(app);
+                break;
+            }
+            case 4: {
+                std::string app;
+                CustomIO::PrintToScreen("Enter the app/website name to find: ");
+                CustomIO::GetInputLine(app);
+                manager->FindPassword(app);
+                break;
+            }
+            case 5: {
+                std::string tags, days;
+                CustomIO::PrintToScreen("Enter tags separated by commas (optional): ");
+                CustomIO::GetInputLine(tags);
+                CustomIO::PrintToScreen("Only passwords older than how many days (optional): ");
+                CustomIO::GetInputLine(days);
+                manager->FilterPasswords(tags, std::max(0, std::atoi(days.c_str()))); // invalid input means no age filter
+                break;
+            }
+            case 6: {
+                std::string names, length, charset;
+                std::vector<std::string> apps;
+                CustomIO::PrintToScreen("Enter app/website names separated by commas, or @file with one name per line: ");
+                CustomIO::GetInputLine(names);
+                if (!readAppNames(names, apps)) {
+                    CustomTerminal::AddMessageToBuffer("Could not read " + names.substr(1) + ".", 2);
+                    break;
+                }
+                if (apps.empty()) break;
+                CustomIO::PrintToScreen(("Password length (optional, default " + std::to_string(PG_DEFAULT_LENGTH) + "): ").c_str());
+                CustomIO::GetInputLine(length);
+                CustomIO::PrintToScreen("Characters - 1. all (default), 2. letters and digits, 3. digits only: ");
+                CustomIO::GetInputLine(charset);
+
+                PasswordPolicy policy;
+                if (std::atoi(length.c_str()) > 0) policy.minLength = policy.maxLength = static_cast<size_t>(std::atoi(length.c_str()));
+                if (charset == "2") policy.classes = PG_CLASS_LOWER | PG_CLASS_UPPER | PG_CLASS_DIGITS;
+                else if (charset == "3") policy.classes = PG_CLASS_DIGITS;
+                manager->GeneratePasswords(apps, policy); // use Find a password to read one
+                vaults.EvictOverLimit();
+                break;
+            }
+            case 7: {
+                std::string name;
+                CustomIO::PrintToScreen("Enter the vault name or path: ");
+                CustomIO::GetInputLine(name);
+                if (name.empty()) break;
+                savePath = VaultCache::ResolvePath(name);
+                manager = &vaults.Open(savePath); // instant if the vault is still open
+                CustomTerminal::AddMessageToBuffer("Switched to vault " + savePath.filename().string() + ".", 2);
                 break;
             }
-            case 4: // do nothing - this avoids adding invalid message to buffer 
+            case 8: // do nothing - this avoids adding invalid message to buffer 
                 break;
             default:
                 CustomTerminal::AddMessageToBuffer("Invalid option. Please try again and select number from menu.", 2);
         }
 
-    } while (choice != 4);
+    } while (choice != 8);
 
-    if (!manager.CommitData(savePath, hexEncrypt)) { // attempt to commit data to file, if not successful, pause to display error
+    if (!vaults.CommitAll()) { // attempt to commit every open vault to file, if not successful, pause to display error
         CustomTerminal::PrintAndClearBuffer(); // display messages in buffer
         system("pause"); 
     }
 
 }
+
+int runFindPassword(const char* adminPassword, const char* app, const char* vault) {
+
+    std::string input;
+    SecureString pass;
+    HEXEncryption hexEncrypt;
+    std::filesystem::path savePath = VaultCache::ResolvePath(vault);
+
+    std::cerr << "Enter master password: "; // keep standard output clean for the caller
+    CustomIO::GetInput(input);
+    if (input != adminPassword) {
+        Logger::Error("Access denied!");
+        return 1;
+    }
+
+    if (!CustomIO::FindInFile(savePath, app, hexEncrypt, pass)) {
+        Logger::Error("Could not find entry.");
+        return 1;
+    }
+
+    std::cout.write(pass.data(), pass.size()) << std::endl;
+    return 0;
+}
+
+int runVerifyVault(const char* vault) {
+
+    VerifyReport report;
+    std::filesystem::path savePath = VaultCache::ResolvePath(vault);
+
+    if (!CustomIO::VerifyFile(savePath, report)) {
+        Logger::Error("Could not read the vault file.");
+        return 1;
+    }
+
+    for (const VaultDamage& damage : report.damaged) {
+        std::cout << "Line " << damage.line << " (byte " << damage.offset << "): " << damage.reason;
+        if (damage.records > 1) std::cout << ", compressed block of " << damage.records << " records";
+        std::cout << std::endl;
+    }
+    std::cout << report.lines << " line(s) checked, " << report.damaged.size() << " damaged";
+    if (report.unchecked > 0) std::cout << ", " << report.unchecked << " without checksum (saved by an older version)";
+    std::cout << std::endl;
+
+    return report.damaged.empty() ? 0 : 1;
+}
+
+/**
+ * @brief Prints the entries of a diff or merge report, one per line.
+ */
+static void printMergeReport(const MergeReport& report) {
+    static const char* labels[] = { "added", "removed", "changed", "kept" };
+    for (const MergeEntry& entry : report.entries) {
+        std::cout << "  " << std::left << std::setw(8) << labels[static_cast<int>(entry.change)] << std::right << entry.app;
+        if (entry.conflict) std::cout << " (conflict)";
+        std::cout << std::endl;
+    }
+    std::cout << report.added << " added, " << report.removed << " removed, " << report.changed << " changed, "
+        << report.unchanged << " unchanged, " << report.conflicts << " conflict(s)" << std::endl;
+}
+
+// Asks for the master password on standard error, keeping standard output for the report.
+static bool authenticate(const char* adminPassword) {
+    std::string input;
+    std::cerr << "Enter master password: ";
+    CustomIO::GetInput(input);
+    if (input != adminPassword) {
+        Logger::Error("Access denied!");
+        return false;
+    }
+    return true;
+}
+
+int runDiffVaults(const char* adminPassword, const char* other, const char* vault) {
+
+    HEXEncryption hexEncrypt;
+    MergeReport report;
+    if (!authenticate(adminPassword)) return 1;
+
+    if (!VaultMerge::Diff(VaultCache::ResolvePath(vault), VaultCache::ResolvePath(other), hexEncrypt, report)) {
+        Logger::Error("Could not read the vault files.");
+        return 1;
+    }
+    if (report.damaged > 0) Logger::Warning((std::to_string(report.damaged) + " damaged line(s) were skipped, run with --verify for details.").c_str());
+
+    printMergeReport(report);
+    return report.entries.empty() ? 0 : 1;
+}
+
+int runMergeVaults(const char* adminPassword, const char* other, const char* base, const char* policy, const char* vault) {
+
+    HEXEncryption hexEncrypt;
+    MergeReport report;
+    MergePolicy mergePolicy = MergePolicy::Ours;
+    if (policy != nullptr && !VaultMerge::ParsePolicy(policy, mergePolicy)) {
+        Logger::Error("Unknown merge policy, use ours, theirs or newest.");
+        return 1;
+    }
+    if (!authenticate(adminPassword)) return 1;
+
+    std::filesystem::path savePath = VaultCache::ResolvePath(vault);
+    std::filesystem::path basePath = base != nullptr ? VaultCache::ResolvePath(base) : std::filesystem::path();
+    if (!VaultMerge::Merge(basePath, savePath, VaultCache::ResolvePath(other), savePath, hexEncrypt, mergePolicy, report)) {
+        if (report.damaged > 0) Logger::Error((std::to_string(report.damaged) + " damaged line(s) in the vaults, nothing was merged. Run with --verify for details.").c_str());
+        else Logger::Error("Could not merge the vaults, nothing was changed.");
+        return 1;
+    }
+
+    printMergeReport(report);
+    return 0;
+}
@@ -0,0 +1,400 @@
+/******************************************************************************
+ * Project: Password Manager - Console App
+ * File: entry_metadata.cpp
+ * Description:
+ *   Per-entry metadata (username, timestamps, tags, previous passwords)
+ *   kept as a struct-of-arrays table and stored as compact columns.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.2.0
+ * Author: Ghost
+ * Created On: 10-19-2026
+ * Last Modified: 10-19-2026
+ *****************************************************************************/
+
+#include "../include/entry_metadata.h"
+#include <algorithm>
+#include <numeric>
+
+#define EM_FORMAT_VERSION 1
+
+// Stores a copy of `name` in `owned`, returns a view of it that stays valid until it is erased.
+template <typename Owned>
+static std::string_view Own(Owned& owned, std::string_view name) {
+    auto copy = std::make_unique<std::string>(name);
+    std::string_view view = *copy;
+    owned.emplace(view, std::move(copy));
+    return view;
+}
+
+// LEB128 style variable length integer, 7 bits per byte.
+static void AppendVarint(SecureString& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+// Maps signed deltas to small unsigned values: 0, -1, 1, -2, ... -> 0, 1, 2, 3, ...
+static uint64_t ZigZag(int64_t value) {
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+static int64_t UnZigZag(uint64_t value) {
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+// Time deltas are taken modulo 2^64: any two stored times have one, and a corrupt delta read from
+// a file cannot overflow a signed value. Both directions wrap the same way, so tables round trip.
+static int64_t WrappingAdd(int64_t a, int64_t b) {
+    return static_cast<int64_t>(static_cast<uint64_t>(a) + static_cast<uint64_t>(b));
+}
+
+static int64_t WrappingSub(int64_t a, int64_t b) {
+    return static_cast<int64_t>(static_cast<uint64_t>(a) - static_cast<uint64_t>(b));
+}
+
+static void AppendBytes(SecureString& out, const char* data, size_t size) {
+    AppendVarint(out, size);
+    out.append(data, size);
+}
+
+// Bounds checked reader over a Serialize output.
+struct ColumnReader {
+    const char* data;
+    size_t size;
+    size_t pos = 0;
+
+    bool Varint(uint64_t& value) {
+        value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (pos >= size) return false;
+            unsigned char byte = static_cast<unsigned char>(data[pos++]);
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) return true;
+        }
+        return false;
+    }
+
+    bool Bytes(const char*& bytes, size_t& length) {
+        uint64_t value;
+        if (!Varint(value) || value > size - pos) return false;
+        bytes = data + pos;
+        length = static_cast<size_t>(value);
+        pos += length;
+        return true;
+    }
+
+    template <typename Str>
+    bool String(Str& out) {
+        const char* bytes;
+        size_t length;
+        if (!Bytes(bytes, length)) return false;
+        out.assign(bytes, length);
+        return true;
+    }
+};
+
+EntryMetadata::EntryMetadata(const EntryMetadata& other)
+    : m_TagNames(other.m_TagNames), m_Modified(other.m_Modified), m_TagMasks(other.m_TagMasks),
+      m_Created(other.m_Created), m_Usernames(other.m_Usernames), m_History(other.m_History) {
+    m_Names.reserve(other.m_Names.size());
+    m_Rows.reserve(other.m_Names.size());
+    for (std::string_view name : other.m_Names) {
+        std::string_view owned = Own(m_OwnedNames, name);
+        m_Rows.emplace(owned, m_Names.size());
+        m_Names.push_back(owned);
+    }
+}
+
+EntryMetadata& EntryMetadata::operator=(const EntryMetadata& other) {
+    if (this != &other) *this = EntryMetadata(other);
+    return *this;
+}
+
+size_t EntryMetadata::Row(std::string_view app) const {
+    auto it = m_Rows.find(app);
+    return it == m_Rows.end() ? EM_NO_ROW : it->second;
+}
+
+size_t EntryMetadata::Size() const {
+    return m_Names.size();
+}
+
+size_t EntryMetadata::AddRow(std::string_view app, bool reference) {
+    size_t row = m_Names.size();
+    std::string_view name = reference ? app : Own(m_OwnedNames, app);
+    m_Rows.emplace(name, row);
+    m_Names.push_back(name);
+    m_Usernames.emplace_back();
+    m_Created.push_back(0);
+    m_Modified.push_back(0);
+    m_TagMasks.push_back(0);
+    m_History.emplace_back();
+    return row;
+}
+
+size_t EntryMetadata::Touch(const std::string& app, int64_t now, const SecureString* previous) {
+    size_t row = Row(app);
+    if (row == EM_NO_ROW) {
+        row = AddRow(app, m_Bound);
+        m_Created[row] = now;
+    }
+    if (previous != nullptr) {
+        auto& history = m_History[row];
+        history.insert(history.begin(), HistoryEntry{ now, *previous });
+        if (history.size() > EM_HISTORY_DEPTH) history.resize(EM_HISTORY_DEPTH); // SecureString wipes the dropped one
+    }
+    m_Modified[row] = now;
+    return row;
+}
+
+void EntryMetadata::Ensure(const std::string& app) {
+    if (Row(app) == EM_NO_ROW) AddRow(app, m_Bound);
+}
+
+void EntryMetadata::Bind(const std::string& key) {
+    auto it = m_Rows.find(key);
+    if (it == m_Rows.end()) {
+        AddRow(key, true);
+        return;
+    }
+    if (it->first.data() == key.data()) return; // already bound
+
+    // Re-key the node in place, then the owned copy is no longer referenced
+    std::string_view owned = it->first;
+    size_t row = it->second;
+    auto node = m_Rows.extract(it);
+    node.key() = key;
+    m_Rows.insert(std::move(node));
+    m_Names[row] = key;
+    DropOwned(owned);
+}
+
+void EntryMetadata::DropOwned(std::string_view name) {
+    auto it = m_OwnedNames.find(name);
+    if (it != m_OwnedNames.end() && it->first.data() == name.data()) m_OwnedNames.erase(it);
+}
+
+bool EntryMetadata::Remove(std::string_view app) {
+    auto it = m_Rows.find(app);
+    if (it == m_Rows.end()) return false;
+
+    // Move the last row into the hole so every column stays dense
+    size_t row = it->second, last = m_Names.size() - 1;
+    std::string_view name = m_Names[row]; // `app` may reference it
+    m_Rows.erase(it);
+    if (row != last) {
+        m_Rows[m_Names[last]] = row;
+        m_Names[row] = std::move(m_Names[last]);
+        m_Usernames[row] = std::move(m_Usernames[last]);
+        m_Created[row] = m_Created[last];
+        m_Modified[row] = m_Modified[last];
+        m_TagMasks[row] = m_TagMasks[last];
+        m_History[row] = std::move(m_History[last]);
+    }
+    m_Names.pop_back();
+    m_Usernames.pop_back();
+    m_Created.pop_back();
+    m_Modified.pop_back();
+    m_TagMasks.pop_back();
+    m_History.pop_back();
+    DropOwned(name);
+    return true;
+}
+
+void EntryMetadata::SetUsername(size_t row, const std::string& username) {
+    m_Usernames[row] = username;
+}
+
+bool EntryMetadata::SetTags(size_t row, const std::vector<std::string>& tags) {
+    auto newTags = [&]() {
+        return std::count_if(tags.begin(), tags.end(), [&](const std::string& tag) {
+            return std::find(m_TagNames.begin(), m_TagNames.end(), tag) == m_TagNames.end();
+        });
+    };
+
+    // Make room first, compacting renumbers the tags so it can't happen while the mask is built
+    if (m_TagNames.size() + newTags() > EM_MAX_TAGS) {
+        CompactTags();
+        if (m_TagNames.size() + newTags() > EM_MAX_TAGS) return false;
+    }
+
+    uint64_t mask = 0;
+    for (const std::string& tag : tags) mask |= static_cast<uint64_t>(1) << TagBit(tag);
+    m_TagMasks[row] = mask;
+    return true;
+}
+
+bool EntryMetadata::CopyRow(const EntryMetadata& from, size_t fromRow) {
+    size_t row = Row(from.m_Names[fromRow]);
+    if (row == EM_NO_ROW) row = AddRow(from.m_Names[fromRow], false); // not a key of the bound map
+    m_Usernames[row] = from.m_Usernames[fromRow];
+    m_Created[row] = from.m_Created[fromRow];
+    m_Modified[row] = from.m_Modified[fromRow];
+    m_History[row] = from.m_History[fromRow];
+    m_TagMasks[row] = 0;
+    return SetTags(row, from.Tags(fromRow));
+}
+
+void EntryMetadata::Patch(const EntryMetadata& rows) {
+    for (size_t row = 0; row < rows.Size(); ++row) CopyRow(rows, row);
+}
+
+std::string_view EntryMetadata::Name(size_t row) const { return m_Names[row]; }
+const std::string& EntryMetadata::Username(size_t row) const { return m_Usernames[row]; }
+int64_t EntryMetadata::Created(size_t row) const { return m_Created[row]; }
+int64_t EntryMetadata::Modified(size_t row) const { return m_Modified[row]; }
+const SecureVector<HistoryEntry>& EntryMetadata::History(size_t row) const { return m_History[row]; }
+
+std::vector<std::string> EntryMetadata::Tags(size_t row) const {
+    std::vector<std::string> tags;
+    for (size_t bit = 0; bit < m_TagNames.size(); ++bit) {
+        if (m_TagMasks[row] & (static_cast<uint64_t>(1) << bit)) tags.push_back(m_TagNames[bit]);
+    }
+    return tags;
+}
+
+std::vector<size_t> EntryMetadata::Filter(const std::vector<std::string>& tags, int64_t modifiedBefore) const {
+    std::vector<size_t> rows;
+    uint64_t required = 0;
+    for (const std::string& tag : tags) {
+        auto it = std::find(m_TagNames.begin(), m_TagNames.end(), tag);
+        if (it == m_TagNames.end()) return rows; // nobody has an unknown tag
+        required |= static_cast<uint64_t>(1) << (it - m_TagNames.begin());
+    }
+
+    // Only the two hot columns are read, both contiguous
+    const int64_t* modified = m_Modified.data();
+    const uint64_t* masks = m_TagMasks.data();
+    for (size_t row = 0; row < m_Names.size(); ++row) {
+        if ((masks[row] & required) == required && modified[row] < modifiedBefore) rows.push_back(row);
+    }
+    return rows;
+}
+
+size_t EntryMetadata::MemoryUsage() const {
+    size_t bytes = m_Names.size() * (sizeof(int64_t) * 2 + sizeof(uint64_t) + sizeof(std::string_view) + 48); // columns plus lookup node
+    for (const auto& owned : m_OwnedNames) bytes += sizeof(std::string) + owned.second->capacity() + 48;
+    for (size_t row = 0; row < m_Names.size(); ++row) {
+        bytes += m_Usernames[row].capacity();
+        for (const HistoryEntry& entry : m_History[row]) bytes += sizeof(HistoryEntry) + entry.password.capacity();
+    }
+    return bytes;
+}
+
+int EntryMetadata::TagBit(const std::string& tag) {
+    auto it = std::find(m_TagNames.begin(), m_TagNames.end(), tag);
+    if (it != m_TagNames.end()) return static_cast<int>(it - m_TagNames.begin());
+    if (m_TagNames.size() >= EM_MAX_TAGS) return -1;
+    m_TagNames.push_back(tag);
+    return static_cast<int>(m_TagNames.size() - 1);
+}
+
+void EntryMetadata::CompactTags() {
+    uint64_t used = 0;
+    for (uint64_t mask : m_TagMasks) used |= mask;
+
+    std::vector<std::string> names;
+    std::vector<int> remap(m_TagNames.size(), -1);
+    for (size_t bit = 0; bit < m_TagNames.size(); ++bit) {
+        if (used & (static_cast<uint64_t>(1) << bit)) {
+            remap[bit] = static_cast<int>(names.size());
+            names.push_back(std::move(m_TagNames[bit]));
+        }
+    }
+    for (uint64_t& mask : m_TagMasks) {
+        uint64_t remapped = 0;
+        for (size_t bit = 0; bit < remap.size(); ++bit) {
+            if (mask & (static_cast<uint64_t>(1) << bit)) remapped |= static_cast<uint64_t>(1) << remap[bit];
+        }
+        mask = remapped;
+    }
+    m_TagNames = std::move(names);
+}
+
+void EntryMetadata::Serialize(SecureString& out) const {
+    // Rows are written oldest first, so consecutive creation times are close and their deltas small
+    std::vector<size_t> order(m_Names.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return m_Created[a] < m_Created[b]; });
+
+    AppendVarint(out, EM_FORMAT_VERSION);
+    AppendVarint(out, m_TagNames.size());
+    for (const std::string& tag : m_TagNames) AppendBytes(out, tag.data(), tag.size());
+    AppendVarint(out, order.size());
+
+    for (size_t row : order) AppendBytes(out, m_Names[row].data(), m_Names[row].size());
+    for (size_t row : order) AppendBytes(out, m_Usernames[row].data(), m_Usernames[row].size());
+    int64_t previous = 0;
+    for (size_t row : order) {
+        AppendVarint(out, ZigZag(WrappingSub(m_Created[row], previous)));
+        previous = m_Created[row];
+    }
+    for (size_t row : order) AppendVarint(out, ZigZag(WrappingSub(m_Modified[row], m_Created[row])));
+    for (size_t row : order) AppendVarint(out, m_TagMasks[row]);
+    for (size_t row : order) {
+        AppendVarint(out, m_History[row].size());
+        for (const HistoryEntry& entry : m_History[row]) {
+            AppendVarint(out, ZigZag(WrappingSub(m_Modified[row], entry.replaced)));
+            AppendBytes(out, entry.password.data(), entry.password.size());
+        }
+    }
+}
+
+bool EntryMetadata::Deserialize(const char* data, size_t size) {
+    *this = EntryMetadata();
+    ColumnReader reader{ data, size };
+    uint64_t version, tagCount, rowCount, value;
+
+    if (!reader.Varint(version) || version != EM_FORMAT_VERSION) return false;
+    if (!reader.Varint(tagCount) || tagCount > EM_MAX_TAGS) return false;
+    m_TagNames.resize(static_cast<size_t>(tagCount));
+    for (std::string& tag : m_TagNames) {
+        if (!reader.String(tag)) return false;
+    }
+    if (!reader.Varint(rowCount) || rowCount > size) return false; // every row takes at least one byte
+
+    std::string name;
+    for (uint64_t i = 0; i < rowCount; ++i) {
+        if (!reader.String(name) || m_Rows.count(name)) {
+            *this = EntryMetadata();
+            return false;
+        }
+        AddRow(name, false);
+    }
+
+    bool valid = true;
+    int64_t previous = 0;
+    for (size_t row = 0; row < m_Names.size() && valid; ++row) valid = reader.String(m_Usernames[row]);
+    for (size_t row = 0; row < m_Names.size() && valid; ++row) {
+        valid = reader.Varint(value);
+        m_Created[row] = previous = WrappingAdd(previous, UnZigZag(value));
+    }
+    for (size_t row = 0; row < m_Names.size() && valid; ++row) {
+        valid = reader.Varint(value);
+        m_Modified[row] = WrappingAdd(m_Created[row], UnZigZag(value));
+    }
+    for (size_t row = 0; row < m_Names.size() && valid; ++row) valid = reader.Varint(m_TagMasks[row]);
+    for (size_t row = 0; row < m_Names.size() && valid; ++row) {
+        uint64_t count;
+        valid = reader.Varint(count) && count <= EM_HISTORY_DEPTH;
+        for (uint64_t i = 0; i < count && valid; ++i) {
+            HistoryEntry entry;
+            valid = reader.Varint(value) && reader.String(entry.password);
+            entry.replaced = WrappingSub(m_Modified[row], UnZigZag(value));
+            m_History[row].push_back(std::move(entry));
+        }
+    }
+
+    if (!valid || reader.pos != size) {
+        *this = EntryMetadata();
+        return false;
+    }
+    return true;
+}
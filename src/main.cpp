@@ -9,18 +9,48 @@
  * This source code is licensed under the MIT License. For more details, see
  * the LICENSE file in the root directory of this project.
  *
- * Version: v1.1.0
+ * Version: v1.2.0
  * Author: Ghost
  * Created On: 1-28-2025
- * Last Modified: 02-06-2025
+ * Last Modified: 10-19-2026
  *****************************************************************************/
 
 #include "driver.h"
+#include <cstring>
 
 const char* MASTER_PASSWORD = "admin"; // TODO hardcoded password to keep it simple - change to whatever you like
 
-int main() {
+int main(int argc, char* argv[]) {
 
-    runPasswordManager(MASTER_PASSWORD);
+    // Options may come in any order, --vault (a name or a path) applies to every mode
+    const char* vault = "passwords";
+    const char* find = nullptr;
+    const char* other = nullptr;
+    const char* base = nullptr;
+    const char* policy = nullptr;
+    bool verify = false, merge = false, showTiming = false;
+    for (int i = 1; i < argc; ++i) {
+        bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--vault") == 0 && hasValue) vault = argv[++i];
+        else if (std::strcmp(argv[i], "--find") == 0 && hasValue) find = argv[++i];
+        else if (std::strcmp(argv[i], "--verify") == 0) verify = true;
+        else if ((std::strcmp(argv[i], "--diff") == 0 || std::strcmp(argv[i], "--merge") == 0) && hasValue) {
+            merge = argv[i][2] == 'm';
+            other = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--base") == 0 && hasValue) base = argv[++i];
+        else if (std::strcmp(argv[i], "--policy") == 0 && hasValue) policy = argv[++i];
+        else if (std::strcmp(argv[i], "--timing") == 0) showTiming = true;
+    }
+
+    if (find != nullptr) return runFindPassword(MASTER_PASSWORD, find, vault); // one-off lookup for scripts
+    if (verify) return runVerifyVault(vault); // checksum check, nothing is decrypted
+    if (other != nullptr) { // compare or merge copies of a vault
+        if (!merge) return runDiffVaults(MASTER_PASSWORD, other, vault);
+        return runMergeVaults(MASTER_PASSWORD, other, base, policy, vault);
+    }
+
+    // Interactive use: --vault opens a named vault instead of the default one, --timing shows the time to the first menu
+    runPasswordManager(MASTER_PASSWORD, vault, showTiming);
     
 }
@@ -0,0 +1,254 @@
+/******************************************************************************
+ * Project: Password Manager - Console App
+ * File: password_generator.cpp
+ * Description:
+ *   Random password generation: a ChaCha20 based CSPRNG seeded by the
+ *   operating system, and policy driven generators running in parallel.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.2.0
+ * Author: Ghost
+ * Created On: 10-19-2026
+ * Last Modified: 10-19-2026
+ *****************************************************************************/
+
+#include "../include/password_generator.h"
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <bcrypt.h>
+#ifdef _MSC_VER
+#pragma comment(lib, "bcrypt")
+#endif
+#elif defined(__linux__)
+#include <cerrno>
+#include <sys/random.h>
+#else
+#include <unistd.h>
+#ifdef __APPLE__
+#include <sys/random.h>
+#endif
+#endif
+
+#define PG_LOWER_CHARS "abcdefghijklmnopqrstuvwxyz"
+#define PG_UPPER_CHARS "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+#define PG_DIGIT_CHARS "0123456789"
+#define PG_SYMBOL_CHARS "!@#$%^&*()-_=+[]{};:,.<>?/~"
+#define PG_CLASS_COUNT 4
+#define PG_MIN_BATCH_PER_THREAD 256 // passwords per thread below which a batch is not split further
+
+// Quarter round on every lane: a += b; d ^= a; d <<<= 16; ... Constant indices let the compiler see
+// the rows never alias, so each statement becomes one vector instruction over the lanes.
+template <int a, int b, int c, int d>
+static inline void QuarterRound(uint32_t (&x)[16][PG_CHACHA_LANES]) {
+    for (int l = 0; l < PG_CHACHA_LANES; ++l) {
+        x[a][l] += x[b][l]; x[d][l] ^= x[a][l]; x[d][l] = (x[d][l] << 16) | (x[d][l] >> 16);
+        x[c][l] += x[d][l]; x[b][l] ^= x[c][l]; x[b][l] = (x[b][l] << 12) | (x[b][l] >> 20);
+        x[a][l] += x[b][l]; x[d][l] ^= x[a][l]; x[d][l] = (x[d][l] << 8) | (x[d][l] >> 24);
+        x[c][l] += x[d][l]; x[b][l] ^= x[c][l]; x[b][l] = (x[b][l] << 7) | (x[b][l] >> 25);
+    }
+}
+
+// Computes PG_CHACHA_LANES consecutive ChaCha20 blocks of `state` (block counter in words 12-13).
+static void ChaChaBlocks(const uint32_t state[16], uint8_t* out) {
+    uint32_t input[16][PG_CHACHA_LANES], x[16][PG_CHACHA_LANES];
+    for (int i = 0; i < 16; ++i) {
+        for (int l = 0; l < PG_CHACHA_LANES; ++l) input[i][l] = state[i];
+    }
+    for (int l = 0; l < PG_CHACHA_LANES; ++l) {
+        uint64_t counter = (static_cast<uint64_t>(state[13]) << 32 | state[12]) + l;
+        input[12][l] = static_cast<uint32_t>(counter);
+        input[13][l] = static_cast<uint32_t>(counter >> 32);
+    }
+    std::memcpy(x, input, sizeof(x));
+
+    for (int round = 0; round < 10; ++round) { // 20 rounds: column round + diagonal round
+        QuarterRound<0, 4, 8, 12>(x);
+        QuarterRound<1, 5, 9, 13>(x);
+        QuarterRound<2, 6, 10, 14>(x);
+        QuarterRound<3, 7, 11, 15>(x);
+        QuarterRound<0, 5, 10, 15>(x);
+        QuarterRound<1, 6, 11, 12>(x);
+        QuarterRound<2, 7, 8, 13>(x);
+        QuarterRound<3, 4, 9, 14>(x);
+    }
+
+    for (int l = 0; l < PG_CHACHA_LANES; ++l) {
+        for (int i = 0; i < 16; ++i) {
+            uint32_t word = x[i][l] + input[i][l];
+            uint8_t* p = out + l * 64 + i * 4;
+            p[0] = static_cast<uint8_t>(word);
+            p[1] = static_cast<uint8_t>(word >> 8);
+            p[2] = static_cast<uint8_t>(word >> 16);
+            p[3] = static_cast<uint8_t>(word >> 24);
+        }
+    }
+    SecurePool::Wipe(x, sizeof(x));
+    SecurePool::Wipe(input, sizeof(input));
+}
+
+// Fills `out` from the operating system's CSPRNG.
+static bool SystemRandom(uint8_t* out, size_t size) {
+#ifdef _WIN32
+    return BCryptGenRandom(nullptr, out, static_cast<ULONG>(size), BCRYPT_USE_SYSTEM_PREFERRED_RNG) == 0;
+#elif defined(__linux__)
+    while (size > 0) {
+        ssize_t read = getrandom(out, size, 0);
+        if (read < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        out += read;
+        size -= static_cast<size_t>(read);
+    }
+    return true;
+#else
+    return getentropy(out, size) == 0; // at most 256 bytes, we only ever ask for a key
+#endif
+}
+
+ChaCha20Rng::ChaCha20Rng() : m_Key{}, m_Buffer{}, m_Position(sizeof(m_Buffer)) {}
+
+ChaCha20Rng::~ChaCha20Rng() {
+    SecurePool::Wipe(m_Key, sizeof(m_Key));
+    SecurePool::Wipe(m_Buffer, sizeof(m_Buffer));
+}
+
+bool ChaCha20Rng::SeedFromSystem() {
+    uint8_t key[PG_KEY_SIZE];
+    if (!SystemRandom(key, sizeof(key))) return false;
+    Seed(key);
+    SecurePool::Wipe(key, sizeof(key));
+    return true;
+}
+
+void ChaCha20Rng::Seed(const uint8_t key[PG_KEY_SIZE]) {
+    for (int i = 0; i < PG_KEY_SIZE / 4; ++i) {
+        m_Key[i] = key[i * 4] | (key[i * 4 + 1] << 8) | (key[i * 4 + 2] << 16) | (static_cast<uint32_t>(key[i * 4 + 3]) << 24);
+    }
+    m_Position = sizeof(m_Buffer); // drop output of the previous key
+}
+
+void ChaCha20Rng::Refill() {
+    // "expand 32-byte k", the key, a zero counter and nonce: every refill uses a fresh key
+    uint32_t state[16] = { 0x61707865, 0x3320646e, 0x79622d32, 0x6b206574 };
+    std::memcpy(state + 4, m_Key, sizeof(m_Key));
+    ChaChaBlocks(state, m_Buffer);
+    SecurePool::Wipe(state, sizeof(state));
+
+    // Fast key erasure: the first bytes become the next key and are never returned
+    Seed(m_Buffer);
+    SecurePool::Wipe(m_Buffer, PG_KEY_SIZE);
+    m_Position = PG_KEY_SIZE;
+}
+
+void ChaCha20Rng::Fill(uint8_t* out, size_t size) {
+    while (size > 0) {
+        if (m_Position == sizeof(m_Buffer)) Refill();
+        size_t chunk = std::min(size, sizeof(m_Buffer) - m_Position);
+        std::memcpy(out, m_Buffer + m_Position, chunk);
+        SecurePool::Wipe(m_Buffer + m_Position, chunk); // handed out bytes don't stay behind
+        m_Position += chunk;
+        out += chunk;
+        size -= chunk;
+    }
+}
+
+uint32_t ChaCha20Rng::Uniform(uint32_t bound) {
+    if (bound <= 1) return 0;
+    uint32_t limit = UINT32_MAX - UINT32_MAX % bound; // values at or above the last full multiple of bound are rejected
+    uint32_t value;
+    do {
+        Fill(reinterpret_cast<uint8_t*>(&value), sizeof(value));
+    } while (value >= limit);
+    return value % bound;
+}
+
+PasswordGenerator::PasswordGenerator(const PasswordPolicy& policy) : m_Policy(policy) {
+    static const char* classChars[PG_CLASS_COUNT] = { PG_LOWER_CHARS, PG_UPPER_CHARS, PG_DIGIT_CHARS, PG_SYMBOL_CHARS };
+
+    auto add = [&](char c, uint8_t charClass) {
+        if (m_Policy.exclude.find(c) != std::string::npos || m_Charset.find(c) != std::string::npos) return false;
+        m_Charset += c;
+        m_ClassOf.push_back(charClass);
+        return true;
+    };
+
+    for (uint8_t charClass = 0; charClass < PG_CLASS_COUNT; ++charClass) {
+        if (!(m_Policy.classes & (1u << charClass))) continue;
+        bool any = false;
+        for (const char* c = classChars[charClass]; *c; ++c) any |= add(*c, charClass);
+        if (any && m_Policy.requireEachClass) m_RequiredClasses |= 1u << charClass; // a fully excluded class can't be required
+    }
+    for (char c : m_Policy.extra) add(c, PG_CLASS_COUNT);
+
+    size_t required = 0;
+    for (uint32_t bits = m_RequiredClasses; bits; bits &= bits - 1) required++;
+    bool satisfiable = !m_Charset.empty() && m_Policy.minLength > 0 && m_Policy.minLength <= m_Policy.maxLength &&
+        m_Policy.maxLength <= PG_MAX_LENGTH && m_Policy.minLength >= required;
+    if (!satisfiable) return;
+
+    m_Limit = 256 - 256 % static_cast<uint32_t>(m_Charset.size());
+    m_Valid = m_Rng.SeedFromSystem();
+}
+
+bool PasswordGenerator::IsValid() const {
+    return m_Valid;
+}
+
+bool PasswordGenerator::Generate(SecureString& out) {
+    if (!m_Valid) return false;
+
+    uint8_t random[64];
+    size_t length = m_Policy.minLength + m_Rng.Uniform(static_cast<uint32_t>(m_Policy.maxLength - m_Policy.minLength + 1));
+    uint32_t present;
+    do {
+        out.clear();
+        present = 0;
+        while (out.size() < length) {
+            m_Rng.Fill(random, sizeof(random));
+            for (size_t i = 0; i < sizeof(random) && out.size() < length; ++i) {
+                if (random[i] >= m_Limit) continue; // rejection keeps every character equally likely
+                size_t index = random[i] % m_Charset.size();
+                out.push_back(m_Charset[index]);
+                present |= 1u << m_ClassOf[index];
+            }
+        }
+    } while ((present & m_RequiredClasses) != m_RequiredClasses);
+
+    SecurePool::Wipe(random, sizeof(random));
+    return true;
+}
+
+bool PasswordGenerator::GenerateBatch(const PasswordPolicy& policy, size_t count, SecureVector<SecureString>& out) {
+    out.clear();
+    out.resize(count);
+    size_t threadCount = std::max<size_t>(1, std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), count / PG_MIN_BATCH_PER_THREAD));
+    std::vector<char> succeeded(threadCount, 0);
+
+    // Contiguous ranges, so each thread writes its own part of `out`
+    auto worker = [&](size_t t) {
+        PasswordGenerator generator(policy);
+        bool ok = generator.IsValid();
+        for (size_t i = count * t / threadCount; ok && i < count * (t + 1) / threadCount; ++i) ok = generator.Generate(out[i]);
+        succeeded[t] = ok;
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t t = 1; t < threadCount; ++t) threads.emplace_back(worker, t);
+    worker(0);
+    for (auto& thread : threads) thread.join();
+
+    if (std::find(succeeded.begin(), succeeded.end(), 0) != succeeded.end()) {
+        out.clear(); // SecureString wipes whatever was generated
+        return false;
+    }
+    return true;
+}
@@ -14,62 +14,265 @@
  * This source code is licensed under the MIT License. For more details, see
  * the LICENSE file in the root directory of this project.
  *
- * Version: v1.1.0
+ * Version: v1.2.0
  * Author: Ghost
  * Created On: 02-06-2025
- * Last Modified: 02-06-2025
+ * Last Modified: 10-19-2026
  *****************************************************************************/
 
 #include "password_manager.h"
 #include "custom_terminal.h"
 #include "custom_io.h"
+#include <algorithm>
+#include <ctime>
+#include <string_view>
 
-PasswordManager::PasswordManager(std::unordered_map<std::string, std::string>&& data) 
-    : m_HasUpdated(false) {
+// Splits "work, email,,shared" into trimmed, non-empty, unique tags.
+static std::vector<std::string> SplitTags(const std::string& tags) {
+    std::vector<std::string> result;
+    size_t start = 0;
+    while (start <= tags.size()) {
+        size_t end = tags.find(',', start);
+        if (end == std::string::npos) end = tags.size();
+        size_t first = tags.find_first_not_of(" \t", start);
+        size_t last = tags.find_last_not_of(" \t", end - 1);
+        if (first != std::string::npos && first < end && last >= first) {
+            std::string tag = tags.substr(first, last - first + 1);
+            if (std::find(result.begin(), result.end(), tag) == result.end()) result.push_back(std::move(tag));
+        }
+        start = end + 1;
+    }
+    return result;
+}
+
+// Formats a unix time as "YYYY-MM-DD (N days ago)", or "unknown" for 0.
+static std::string FormatAge(int64_t time, int64_t now) {
+    if (time == 0) return "unknown";
+    std::time_t timeT = static_cast<std::time_t>(time);
+    std::tm localTime{};
+#ifdef _WIN32
+    localtime_s(&localTime, &timeT);
+#else
+    localtime_r(&timeT, &localTime);
+#endif
+    char date[16];
+    std::strftime(date, sizeof(date), "%Y-%m-%d", &localTime);
+    return std::string(date) + " (" + std::to_string((now - time) / EM_SECONDS_PER_DAY) + " days ago)";
+}
+
+static std::string JoinTags(const std::vector<std::string>& tags) {
+    std::string joined;
+    for (size_t i = 0; i < tags.size(); ++i) {
+        if (i > 0) joined += ", ";
+        joined += tags[i];
+    }
+    return joined;
+}
+
+PasswordManager::PasswordManager(PasswordMap&& data, EntryMetadata&& metadata) 
+    : m_Metadata(std::move(metadata)) {
 
     m_DataMap = std::move(data); // transfer ownership of rvlaue to class member
+    for (const auto& [app, pass] : m_DataMap) m_NameIndex.Insert(app);
+    m_Metadata.Reconcile(m_DataMap);
 }
 
-void PasswordManager::AddPassword(std::string& app, std::string& pass) {
+void PasswordManager::AddPassword(std::string& app, std::string& pass, const std::string& username, const std::string& tags) {
     if (app.empty()) {
         CustomTerminal::AddMessageToBuffer("Password requires an app name, try again!", 2);
         return;
     }
 
-    if (!m_HasUpdated) m_HasUpdated = true;
+    RecordChange(app, !username.empty() || !tags.empty());
+
+    std::string message;
+    switch (StorePassword(app, pass, static_cast<int64_t>(std::time(nullptr)))) {
+    case StoreResult::Added: message = "Password added successfully!"; break;
+    case StoreResult::Updated: message = "Password updated, the previous one was kept in the history."; break;
+    case StoreResult::Unchanged: message = "Entry updated."; break;
+    }
 
-    m_DataMap[app] = pass;
+    size_t row = m_Metadata.Row(app);
+    if (!username.empty()) m_Metadata.SetUsername(row, username);
+    if (!tags.empty() && !m_Metadata.SetTags(row, SplitTags(tags))) {
+        message += " Tags were not changed, a vault can use at most " + std::to_string(EM_MAX_TAGS) + " different tags.";
+    }
 
-    CustomTerminal::AddMessageToBuffer("Password added successfully!", 2);
+    CustomTerminal::AddMessageToBuffer(std::move(message), 2);
 }
 
-void PasswordManager::DeletePassword(std::string& app) {
-    if (!m_HasUpdated) m_HasUpdated = true;
+PasswordManager::StoreResult PasswordManager::StorePassword(const std::string& app, std::string_view pass, int64_t now) {
+    auto it = m_DataMap.find(app);
+    bool unchanged = it != m_DataMap.end() && std::string_view(it->second.data(), it->second.size()) == pass;
+    RecordChange(app, !unchanged); // a new entry gets new timestamps, a replaced password goes to the history
+    if (it == m_DataMap.end()) {
+        it = m_DataMap.emplace(app, SecureString(pass.data(), pass.size())).first;
+        m_NameIndex.Insert(app);
+        m_Metadata.Touch(it->first, now); // the row references the map key
+        return StoreResult::Added;
+    }
+    if (unchanged) return StoreResult::Unchanged;
+
+    m_Metadata.Touch(it->first, now, &it->second); // the replaced password goes to the history
+    it->second.assign(pass.data(), pass.size());
+    return StoreResult::Updated;
+}
+
+size_t PasswordManager::GeneratePasswords(const std::vector<std::string>& apps, const PasswordPolicy& policy) {
+    SecureVector<SecureString> passwords;
+    if (!PasswordGenerator::GenerateBatch(policy, apps.size(), passwords)) {
+        CustomTerminal::AddMessageToBuffer("Could not generate passwords, check the length and character set.", 2);
+        return 0;
+    }
+
+    int64_t now = static_cast<int64_t>(std::time(nullptr));
+    size_t added = 0, updated = 0;
+    for (size_t i = 0; i < apps.size(); ++i) {
+        if (apps[i].empty()) continue;
+        StoreResult result = StorePassword(apps[i], std::string_view(passwords[i].data(), passwords[i].size()), now);
+        added += result == StoreResult::Added;
+        updated += result == StoreResult::Updated;
+    }
 
-    if (m_DataMap.erase(app)) { // erase data from map 
+    std::string message = "Generated " + std::to_string(added + updated) + " password(s): " + std::to_string(added) + " added, " + std::to_string(updated) + " replaced.";
+    if (updated > 0) message += " The previous passwords were kept in the history.";
+    CustomTerminal::AddMessageToBuffer(std::move(message), 2);
+    return added + updated;
+}
+
+void PasswordManager::DeletePassword(std::string& app) {
+    if (m_DataMap.count(app)) {
+        RecordChange(app, false);
+        m_Metadata.Remove(app); // wipes the password history as well, before the key it references goes
+        m_DataMap.erase(app); // erase data from map
+        m_NameIndex.Remove(app);
         CustomTerminal::AddMessageToBuffer("Password deleted successfully!", 2);
         return;
     } 
-    CustomTerminal::AddMessageToBuffer("Could not find entry.", 2);
+    CustomTerminal::AddMessageToBuffer("Could not find entry." + SuggestNames(app), 2);
+}
+
+void PasswordManager::FindPassword(std::string& app) {
+    auto it = m_DataMap.find(app);
+    if (it != m_DataMap.end()) {
+        size_t row = m_Metadata.Row(app);
+        int64_t now = static_cast<int64_t>(std::time(nullptr));
+        std::string line = "  - App: " + it->first + ", Password: ";
+        line.append(it->second.data(), it->second.size());
+        CustomTerminal::AddMessageToBuffer(std::move(line), 1); // the buffer wipes it once printed
+        if (!m_Metadata.Username(row).empty()) CustomTerminal::AddMessageToBuffer("    Username: " + m_Metadata.Username(row), 1);
+        if (!m_Metadata.Tags(row).empty()) CustomTerminal::AddMessageToBuffer("    Tags: " + JoinTags(m_Metadata.Tags(row)), 1);
+        CustomTerminal::AddMessageToBuffer("    Created: " + FormatAge(m_Metadata.Created(row), now) + ", last changed: " + FormatAge(m_Metadata.Modified(row), now), 1);
+        for (const HistoryEntry& entry : m_Metadata.History(row)) {
+            std::string previous = "    Previous password: ";
+            previous.append(entry.password.data(), entry.password.size()).append(", replaced ").append(FormatAge(entry.replaced, now));
+            CustomTerminal::AddMessageToBuffer(std::move(previous), 1);
+        }
+        CustomTerminal::AddMessageToBuffer("", 1); // space
+        return;
+    }
+    CustomTerminal::AddMessageToBuffer("Could not find entry." + SuggestNames(app), 2);
+}
+
+std::vector<std::string> PasswordManager::FindSimilar(const std::string& app) const {
+    // Short names get a tighter bound, otherwise 2 edits would match almost every short name
+    uint32_t maxDistance = std::min<uint32_t>(PM_FUZZY_MAX_DISTANCE, std::max<uint32_t>(1, static_cast<uint32_t>(app.size() / 3)));
+    return m_NameIndex.Search(app, maxDistance, PM_FUZZY_MAX_RESULTS);
+}
+
+void PasswordManager::FilterPasswords(const std::string& tags, int olderThanDays) {
+    int64_t now = static_cast<int64_t>(std::time(nullptr));
+    int64_t modifiedBefore = olderThanDays > 0 ? now - static_cast<int64_t>(olderThanDays) * EM_SECONDS_PER_DAY : INT64_MAX;
+    std::vector<size_t> rows = m_Metadata.Filter(SplitTags(tags), modifiedBefore);
+
+    CustomTerminal::AddMessageToBuffer("Matching entries: " + std::to_string(rows.size()), 1);
+    for (size_t row : rows) {
+        std::string line = "  - App: " + std::string(m_Metadata.Name(row));
+        if (!m_Metadata.Username(row).empty()) line += ", Username: " + m_Metadata.Username(row);
+        line += ", last changed: " + FormatAge(m_Metadata.Modified(row), now);
+        std::vector<std::string> rowTags = m_Metadata.Tags(row);
+        if (!rowTags.empty()) line += ", Tags: " + JoinTags(rowTags);
+        CustomTerminal::AddMessageToBuffer(std::move(line), 1);
+    }
+    CustomTerminal::AddMessageToBuffer("", 1); // space
+}
+
+std::string PasswordManager::SuggestNames(const std::string& app) const {
+    std::vector<std::string> names = FindSimilar(app);
+    if (names.empty()) return "";
+
+    std::string message = " Did you mean: ";
+    for (size_t i = 0; i < names.size(); ++i) {
+        if (i > 0) message += ", ";
+        message += names[i];
+    }
+    return message + "?";
 }
 
 void PasswordManager::ViewPasswords() {
     CustomTerminal::AddMessageToBuffer("Saved Passwords:", 1);
     if (!m_DataMap.empty()) {
         for (const auto& [app, pass] : m_DataMap) {
-            CustomTerminal::AddMessageToBuffer(("  - App: " + app + ", Password: " + pass), 1);
+            std::string line = "  - App: " + app;
+            size_t row = m_Metadata.Row(app);
+            if (!m_Metadata.Username(row).empty()) line += ", Username: " + m_Metadata.Username(row);
+            line += ", Password: ";
+            line.append(pass.data(), pass.size());
+            CustomTerminal::AddMessageToBuffer(std::move(line), 1); // the buffer wipes it once printed
         }
     }
     else CustomTerminal::AddMessageToBuffer(("  No passwords saved!"), 1);
     CustomTerminal::AddMessageToBuffer("",1); // space
 }
 
-bool PasswordManager::CommitData(std::filesystem::path& filePath, const IEncryption& encryption) {
-    if (m_HasUpdated) {
-        if (!CustomIO::SaveToFile(m_DataMap, filePath, encryption)) {
+void PasswordManager::RecordChange(const std::string& app, bool metadataChanged) {
+    auto [it, first] = m_Changes.try_emplace(app);
+    if (first) {
+        auto saved = m_DataMap.find(app);
+        it->second.existed = saved != m_DataMap.end();
+        if (it->second.existed) it->second.original = saved->second;
+    }
+    it->second.metadataChanged |= metadataChanged;
+}
+
+bool PasswordManager::IsNetChange(const std::string& app, const PendingChange& change) const {
+    auto it = m_DataMap.find(app);
+    if ((it != m_DataMap.end()) != change.existed) return true; // added or removed
+    return it != m_DataMap.end() && (change.metadataChanged || it->second != change.original);
+}
+
+bool PasswordManager::HasChanges() const {
+    for (const auto& [app, change] : m_Changes) {
+        if (IsNetChange(app, change)) return true;
+    }
+    return false;
+}
+
+size_t PasswordManager::MemoryUsage() const {
+    // Names are stored twice (map key and name index), node and bucket overhead is a rough 96 bytes per entry
+    size_t bytes = sizeof(*this);
+    for (const auto& [app, pass] : m_DataMap) bytes += app.capacity() * 2 + pass.capacity() + 96;
+    for (const auto& [app, change] : m_Changes) bytes += app.capacity() + change.original.capacity() + 96;
+    return bytes + m_Metadata.MemoryUsage();
+}
+
+bool PasswordManager::CommitData(std::filesystem::path& filePath, const IEncryption& encryption, bool compress) {
+    // Only the net changes are written: an entry added then deleted, or set back to its saved password, is not
+    std::vector<VaultChange> changes;
+    for (const auto& [app, change] : m_Changes) {
+        if (!IsNetChange(app, change)) continue;
+        auto it = m_DataMap.find(app);
+        changes.push_back({ app, it != m_DataMap.end() ? &it->second : nullptr });
+    }
+
+    if (!changes.empty()) {
+        if (!CustomIO::AppendChanges(filePath, changes, encryption, &m_Metadata) &&
+            !CustomIO::SaveToFile(m_DataMap, filePath, encryption, compress, &m_Metadata)) {
             CustomTerminal::AddMessageToBuffer("There was a problem while attempting to save data to file.", 2);
+            return false;
         }
-        else return true;
+        m_Changes.clear(); // the saved vault now matches, SecureString wipes the saved passwords
+        return true;
     }
     CustomTerminal::AddMessageToBuffer("No changes were made, did not save to file.", 2);
     return false;
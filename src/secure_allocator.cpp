@@ -0,0 +1,249 @@
+/******************************************************************************
+ * Project: Password Manager - Console App
+ * File: secure_allocator.cpp
+ * Description:
+ *   A pool of locked memory pages for decrypted secrets, and the allocator and
+ *   string/map types built on top of it.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.2.0
+ * Author: Ghost
+ * Created On: 10-19-2026
+ * Last Modified: 10-19-2026
+ *****************************************************************************/
+
+#include "../include/secure_allocator.h"
+#include "../include/logger.h"
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+#define SECURE_POOL_MAX_BLOCK (SECURE_POOL_MIN_BLOCK << (SECURE_POOL_CLASSES - 1))
+#define SECURE_POOL_MIN_LARGE (SECURE_POOL_MAX_BLOCK << 1)
+#define SECURE_POOL_MAX_LARGE (SECURE_POOL_MIN_LARGE << (SECURE_POOL_LARGE_CLASSES - 1))
+
+// Set once the calling thread's cache is destroyed, later releases go straight to the pool
+static thread_local bool t_CacheClosed = false;
+
+// Returns the size class for a request, blocks are smallest << class bytes.
+static int SizeClass(size_t size, size_t smallest = SECURE_POOL_MIN_BLOCK) {
+    int sizeClass = 0;
+    size_t blockSize = smallest;
+    while (blockSize < size) {
+        blockSize <<= 1;
+        sizeClass++;
+    }
+    return sizeClass;
+}
+
+SecurePool& SecurePool::Instance() {
+    // Never destroyed on purpose: secure strings owned by other static objects may be
+    // released after this one would be, the pages are returned to the system at exit anyway.
+    static SecurePool* pool = new SecurePool();
+    return *pool;
+}
+
+SecurePool::ThreadCache* SecurePool::LocalCache() {
+    if (t_CacheClosed) return nullptr;
+    static thread_local ThreadCache cache;
+    return &cache;
+}
+
+SecurePool::ThreadCache::~ThreadCache() {
+    for (int sizeClass = 0; sizeClass < SECURE_POOL_CLASSES; ++sizeClass) {
+        Instance().Release(*this, sizeClass, counts[sizeClass]);
+    }
+    t_CacheClosed = true;
+}
+
+void SecurePool::Release(ThreadCache& cache, int sizeClass, size_t count) {
+    if (count == 0) return;
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    for (size_t i = 0; i < count; ++i) {
+        FreeBlock* block = cache.lists[sizeClass];
+        cache.lists[sizeClass] = block->next;
+        cache.counts[sizeClass]--;
+        block->next = m_FreeLists[sizeClass];
+        m_FreeLists[sizeClass] = block;
+    }
+    m_Outstanding -= count;
+    if (m_Outstanding == 0) ReleaseChunks(); // the pool drained, e.g. the last thread holding blocks exited
+}
+
+void* SecurePool::Allocate(size_t size) {
+    if (size == 0) size = 1;
+    if (size > SECURE_POOL_MAX_BLOCK) return AllocateLarge(size);
+
+    int sizeClass = SizeClass(size);
+    size_t blockSize = static_cast<size_t>(SECURE_POOL_MIN_BLOCK) << sizeClass;
+
+    ThreadCache* cache = LocalCache();
+    if (cache != nullptr && cache->lists[sizeClass] != nullptr) { // fastest path: a block this thread freed, no lock
+        FreeBlock* block = cache->lists[sizeClass];
+        cache->lists[sizeClass] = block->next;
+        cache->counts[sizeClass]--;
+        block->next = nullptr;
+        return block;
+    }
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Outstanding++;
+    if (FreeBlock* block = m_FreeLists[sizeClass]) { // fast path: reuse a wiped block
+        m_FreeLists[sizeClass] = block->next;
+        block->next = nullptr;
+        return block;
+    }
+
+    if (m_Chunk == nullptr || m_ChunkUsed + blockSize > SECURE_POOL_CHUNK) {
+        m_Chunks.reserve(m_Chunks.size() + 1); // may throw, nothing is mapped yet
+        m_Chunk = static_cast<char*>(MapPages(SECURE_POOL_CHUNK));
+        m_Chunks.push_back(m_Chunk);
+        m_ChunkUsed = 0;
+    }
+    void* block = m_Chunk + m_ChunkUsed;
+    m_ChunkUsed += blockSize;
+    return block;
+}
+
+void SecurePool::Deallocate(void* ptr, size_t size) {
+    if (ptr == nullptr) return;
+    if (size == 0) size = 1;
+    if (size > SECURE_POOL_MAX_BLOCK) {
+        DeallocateLarge(ptr, size);
+        return;
+    }
+
+    // Only the requested bytes can hold data, the rest of the block is still zero from its last wipe
+    int sizeClass = SizeClass(size);
+    Wipe(ptr, size);
+
+    FreeBlock* block = static_cast<FreeBlock*>(ptr);
+    if (ThreadCache* cache = LocalCache()) {
+        block->next = cache->lists[sizeClass];
+        cache->lists[sizeClass] = block;
+        // A full cache hands half of its blocks back, so other threads can use them
+        if (++cache->counts[sizeClass] >= SECURE_POOL_THREAD_CACHE) Release(*cache, sizeClass, SECURE_POOL_THREAD_CACHE / 2);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    block->next = m_FreeLists[sizeClass];
+    m_FreeLists[sizeClass] = block;
+    if (--m_Outstanding == 0) ReleaseChunks();
+}
+
+void* SecurePool::AllocateLarge(size_t size) {
+    std::lock_guard<std::mutex> lock(m_Mutex); // MapPages may log, keep it serialized
+    if (size > SECURE_POOL_MAX_LARGE) return MapPages(size);
+
+    int sizeClass = SizeClass(size, SECURE_POOL_MIN_LARGE);
+    if (FreeBlock* block = m_LargeFreeLists[sizeClass]) {
+        m_LargeFreeLists[sizeClass] = block->next;
+        m_LargeCached -= static_cast<size_t>(SECURE_POOL_MIN_LARGE) << sizeClass;
+        block->next = nullptr;
+        return block;
+    }
+    return MapPages(static_cast<size_t>(SECURE_POOL_MIN_LARGE) << sizeClass);
+}
+
+void SecurePool::DeallocateLarge(void* ptr, size_t size) {
+    Wipe(ptr, size);
+    if (size > SECURE_POOL_MAX_LARGE) {
+        UnmapPages(ptr, size);
+        return;
+    }
+
+    int sizeClass = SizeClass(size, SECURE_POOL_MIN_LARGE);
+    size_t blockSize = static_cast<size_t>(SECURE_POOL_MIN_LARGE) << sizeClass;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_LargeCached + blockSize <= SECURE_POOL_LARGE_CACHE) {
+            FreeBlock* block = static_cast<FreeBlock*>(ptr);
+            block->next = m_LargeFreeLists[sizeClass];
+            m_LargeFreeLists[sizeClass] = block;
+            m_LargeCached += blockSize;
+            return;
+        }
+    }
+    UnmapPages(ptr, blockSize);
+}
+
+void SecurePool::Trim() {
+    if (ThreadCache* cache = LocalCache()) {
+        for (int sizeClass = 0; sizeClass < SECURE_POOL_CLASSES; ++sizeClass) Release(*cache, sizeClass, cache->counts[sizeClass]);
+    }
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (m_Outstanding == 0) ReleaseChunks();
+    for (int sizeClass = 0; sizeClass < SECURE_POOL_LARGE_CLASSES; ++sizeClass) {
+        while (FreeBlock* block = m_LargeFreeLists[sizeClass]) {
+            m_LargeFreeLists[sizeClass] = block->next;
+            UnmapPages(block, static_cast<size_t>(SECURE_POOL_MIN_LARGE) << sizeClass);
+        }
+    }
+    m_LargeCached = 0;
+}
+
+void SecurePool::ReleaseChunks() {
+    // Every block is on a free list and was wiped when it was freed, the rest of each chunk was never used
+    for (char* chunk : m_Chunks) UnmapPages(chunk, SECURE_POOL_CHUNK);
+    m_Chunks.clear();
+    for (FreeBlock*& list : m_FreeLists) list = nullptr;
+    m_Chunk = nullptr;
+    m_ChunkUsed = 0;
+}
+
+void SecurePool::Wipe(void* ptr, size_t size) {
+    if (ptr == nullptr || size == 0) return;
+#ifdef _WIN32
+    SecureZeroMemory(ptr, size);
+#else
+    std::memset(ptr, 0, size);
+    __asm__ __volatile__("" : : "r"(ptr) : "memory"); // the memory "escapes", so the memset can't be removed
+#endif
+}
+
+void SecurePool::Wipe(std::string& str) {
+    Wipe(str.data(), str.size());
+    str.clear();
+}
+
+void* SecurePool::MapPages(size_t size) {
+    bool locked;
+#ifdef _WIN32
+    void* ptr = VirtualAlloc(nullptr, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+    if (ptr == nullptr) throw std::bad_alloc();
+    locked = VirtualLock(ptr, size) != 0;
+#else
+    void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED) throw std::bad_alloc();
+    locked = mlock(ptr, size) == 0;
+#ifdef MADV_DONTDUMP
+    madvise(ptr, size, MADV_DONTDUMP); // keep secrets out of core dumps
+#endif
+#endif
+
+    if (!locked && !m_LockWarned) {
+        m_LockWarned = true;
+        Logger::Warning("Could not lock memory for secrets, they may be written to swap.");
+    }
+    return ptr;
+}
+
+void SecurePool::UnmapPages(void* ptr, size_t size) {
+#ifdef _WIN32
+    VirtualUnlock(ptr, size);
+    VirtualFree(ptr, 0, MEM_RELEASE);
+#else
+    munlock(ptr, size);
+    munmap(ptr, size);
+#endif
+}
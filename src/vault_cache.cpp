@@ -0,0 +1,113 @@
+/******************************************************************************
+ * Project: Password Manager - Console App
+ * File: vault_cache.cpp
+ * Description:
+ *   Keeps several unlocked vaults open at once, closing the least recently
+ *   used one when a count or memory limit is reached.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.2.0
+ * Author: Ghost
+ * Created On: 10-19-2026
+ * Last Modified: 10-19-2026
+ *****************************************************************************/
+
+#include "../include/vault_cache.h"
+#include "../include/custom_io.h"
+#include "../include/custom_terminal.h"
+#include <iterator>
+
+VaultCache::VaultCache(const IEncryption& encryption, bool compress, size_t maxVaults, size_t maxBytes)
+    : m_Encryption(encryption), m_Compress(compress), m_MaxVaults(maxVaults > 0 ? maxVaults : 1), m_MaxBytes(maxBytes) {}
+
+PasswordManager& VaultCache::Open(const std::filesystem::path& path) {
+    auto found = m_Lookup.find(MakeKey(path));
+    if (found != m_Lookup.end()) { // hit: move to the front, nothing is read or decrypted
+        m_Entries.splice(m_Entries.begin(), m_Entries, found->second);
+        return *found->second->manager;
+    }
+    EntryMetadata metadata;
+    PasswordMap data = CustomIO::LoadFromFile(path, m_Encryption, &metadata);
+    return Insert(path, std::move(data), std::move(metadata));
+}
+
+PasswordManager& VaultCache::Insert(const std::filesystem::path& path, PasswordMap&& data, EntryMetadata&& metadata) {
+    std::string key = MakeKey(path);
+    auto found = m_Lookup.find(key);
+    if (found != m_Lookup.end()) { // already open, the open copy may hold unsaved changes so it wins
+        m_Entries.splice(m_Entries.begin(), m_Entries, found->second);
+        return *found->second->manager;
+    }
+
+    m_Entries.push_front({ path, std::make_unique<PasswordManager>(std::move(data), std::move(metadata)) });
+    m_Lookup[key] = m_Entries.begin();
+    EvictOverLimit();
+    return *m_Entries.front().manager;
+}
+
+bool VaultCache::CommitAll() {
+    bool saved = m_SavedOnEviction, failed = false;
+    m_SavedOnEviction = false;
+    for (Entry& entry : m_Entries) {
+        if (!entry.manager->HasChanges()) continue;
+        if (entry.manager->CommitData(entry.path, m_Encryption, m_Compress)) saved = true;
+        else failed = true;
+    }
+    if (!saved && !failed) CustomTerminal::AddMessageToBuffer("No changes were made, did not save to file.", 2);
+    return saved && !failed;
+}
+
+size_t VaultCache::Size() const {
+    return m_Entries.size();
+}
+
+std::filesystem::path VaultCache::ResolvePath(const std::string& nameOrPath) {
+    std::filesystem::path path(nameOrPath);
+    if (!path.has_parent_path() && !path.has_extension()) return CustomIO::GetSavePath(nameOrPath);
+    if (!path.has_extension()) path.replace_extension(FIO_EXT);
+    return path;
+}
+
+std::string VaultCache::MakeKey(const std::filesystem::path& path) {
+    std::error_code error;
+    std::filesystem::path canonical = std::filesystem::weakly_canonical(path, error);
+    if (error) canonical = std::filesystem::absolute(path, error).lexically_normal();
+    return canonical.string();
+}
+
+bool VaultCache::EvictOverLimit() {
+    size_t bytes = 0;
+    for (const Entry& entry : m_Entries) bytes += entry.manager->MemoryUsage();
+
+    // Vaults are tried from the least recently used one, `next` is the last vault kept so far
+    bool failed = false, closed = false;
+    auto next = m_Entries.end();
+    while ((m_Entries.size() > m_MaxVaults || bytes > m_MaxBytes) && next != m_Entries.begin() && std::prev(next) != m_Entries.begin()) {
+        auto victim = std::prev(next);
+        size_t usage = victim->manager->MemoryUsage();
+        if (victim->manager->HasChanges()) {
+            if (!victim->manager->CommitData(victim->path, m_Encryption, m_Compress)) { // keep a vault that could not be saved open rather than losing its changes
+                failed = true;
+                next = victim;
+                continue;
+            }
+            m_SavedOnEviction = true;
+        }
+        bytes -= usage;
+        CustomTerminal::AddMessageToBuffer("Closed vault " + victim->path.filename().string() + " (least recently used).", 1);
+        m_Lookup.erase(MakeKey(victim->path));
+        m_Entries.erase(victim); // destroying the manager wipes its secrets
+        closed = true;
+    }
+    if (closed) SecurePool::Instance().Trim(); // hand the cached blocks of the closed vaults back to the system
+
+    if (failed && (m_Entries.size() > m_MaxVaults || bytes > m_MaxBytes)) {
+        CustomTerminal::AddMessageToBuffer("A vault could not be saved, it stays open over the open vault limits.", 2);
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,210 @@
+/******************************************************************************
+ * Project: Password Manager - Console App
+ * File: vault_index.cpp
+ * Description:
+ *   A small on-disk index stored next to a vault file. It holds a Bloom filter
+ *   and a hash table of key hashes so a single entry can be found without
+ *   loading and decrypting the whole vault.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.2.0
+ * Author: Ghost
+ * Created On: 10-19-2026
+ * Last Modified: 10-19-2026
+ *****************************************************************************/
+
+#include "../include/vault_index.h"
+#include "../include/checksum.h"
+#include <algorithm>
+#include <cstring>
+
+#define INDEX_MAGIC "PWDX"
+#define INDEX_VERSION 2
+#define INDEX_BLOOM_BLOCK_BYTES 64   // 512 bits, one cache line
+#define INDEX_BLOOM_BITS_PER_KEY 10  // ~1% false positives with 7 probes
+#define INDEX_BLOOM_PROBES 7
+#define INDEX_PROBE_BATCH 16         // slots read per disk access while probing
+#define INDEX_FINGERPRINT_WINDOW 4096 // bytes read at each end of the indexed part to fingerprint it
+
+/**
+ * @brief Fixed size header at the start of the index file (host byte order).
+ */
+struct IndexHeader {
+    char magic[4];
+    uint32_t version;
+    uint64_t vaultSize;
+    uint32_t fingerprint; // see Fingerprint
+    uint32_t reserved;
+    uint64_t entryCount;
+    uint64_t bloomBlocks;
+    uint64_t slotCount;
+};
+
+// Final mix of MurmurHash3, spreads the bits of a hash so different parts of it can be used independently.
+static uint64_t Mix(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+static void SetBloomBits(unsigned char* block, uint64_t hash) {
+    uint64_t bits = Mix(hash);
+    for (int i = 0; i < INDEX_BLOOM_PROBES; ++i) {
+        uint32_t bit = (bits >> (i * 9)) & 511;
+        block[bit >> 3] |= static_cast<unsigned char>(1u << (bit & 7));
+    }
+}
+
+static bool TestBloomBits(const unsigned char* block, uint64_t hash) {
+    uint64_t bits = Mix(hash);
+    for (int i = 0; i < INDEX_BLOOM_PROBES; ++i) {
+        uint32_t bit = (bits >> (i * 9)) & 511;
+        if (!(block[bit >> 3] & (1u << (bit & 7)))) return false;
+    }
+    return true;
+}
+
+// CRC32C of the size and of the first and last INDEX_FINGERPRINT_WINDOW bytes of the first `size`
+// bytes of a vault. Every save rewrites both ends of the file (the first records and the metadata
+// or last block), so another vault, or the same one saved again, almost surely fingerprints
+// differently. Reading the whole indexed part would cost as much as the full load the index avoids.
+static bool Fingerprint(const std::filesystem::path& vaultPath, uint64_t size, uint32_t& crc) {
+    std::ifstream vault(vaultPath, std::ios::binary);
+    char window[INDEX_FINGERPRINT_WINDOW];
+    size_t length = static_cast<size_t>(std::min<uint64_t>(size, INDEX_FINGERPRINT_WINDOW));
+
+    crc = Checksum::Crc32c(reinterpret_cast<const char*>(&size), sizeof(size));
+    if (!vault.read(window, static_cast<std::streamsize>(length))) return false;
+    crc = Checksum::Crc32c(window, length, crc);
+    vault.seekg(static_cast<std::streamoff>(size - length));
+    if (!vault.read(window, static_cast<std::streamsize>(length))) return false;
+    crc = Checksum::Crc32c(window, length, crc);
+    return true;
+}
+
+// Reads and checks the header of an index, `false` if it is damaged or does not describe (a prefix of) the vault.
+static bool ReadHeader(std::ifstream& file, const std::filesystem::path& vaultPath, uint64_t vaultSize, IndexHeader& header) {
+    uint32_t fingerprint;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header))) return false;
+    if (std::memcmp(header.magic, INDEX_MAGIC, 4) != 0 || header.version != INDEX_VERSION) return false;
+    if (header.vaultSize > vaultSize) return false; // vault rewritten since the index was written
+    return Fingerprint(vaultPath, header.vaultSize, fingerprint) && fingerprint == header.fingerprint;
+}
+
+uint64_t VaultIndex::HashKey(std::string_view encryptedKey) {
+    uint64_t hash = 14695981039346656037ULL; // FNV-1a
+    for (unsigned char c : encryptedKey) {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    hash = Mix(hash);
+    return hash != 0 ? hash : 1;
+}
+
+bool VaultIndex::Write(const std::filesystem::path& indexPath, const std::vector<IndexEntry>& entries, const std::filesystem::path& vaultPath, uint64_t vaultSize) {
+    IndexHeader header{};
+    std::memcpy(header.magic, INDEX_MAGIC, 4);
+    header.version = INDEX_VERSION;
+    header.vaultSize = vaultSize;
+    if (!Fingerprint(vaultPath, vaultSize, header.fingerprint)) return false;
+    header.entryCount = entries.size();
+    header.bloomBlocks = (entries.size() * INDEX_BLOOM_BITS_PER_KEY) / (INDEX_BLOOM_BLOCK_BYTES * 8) + 1;
+    header.slotCount = 16;
+    while (header.slotCount * 3 < entries.size() * 4) header.slotCount <<= 1; // load factor <= 0.75 keeps probe runs short
+
+    std::vector<unsigned char> bloom(header.bloomBlocks * INDEX_BLOOM_BLOCK_BYTES, 0);
+    std::vector<IndexEntry> slots(header.slotCount, IndexEntry{ 0, 0 });
+
+    for (const auto& entry : entries) {
+        SetBloomBits(bloom.data() + (entry.hash % header.bloomBlocks) * INDEX_BLOOM_BLOCK_BYTES, entry.hash);
+
+        size_t slot = entry.hash & (header.slotCount - 1);
+        while (slots[slot].hash != 0) slot = (slot + 1) & (header.slotCount - 1); // linear probing
+        slots[slot] = entry;
+    }
+
+    std::ofstream file(indexPath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) return false;
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(bloom.data()), bloom.size());
+    file.write(reinterpret_cast<const char*>(slots.data()), slots.size() * sizeof(IndexEntry));
+    return static_cast<bool>(file);
+}
+
+bool VaultIndex::Open(const std::filesystem::path& indexPath, const std::filesystem::path& vaultPath, uint64_t vaultSize) {
+    m_File.open(indexPath, std::ios::binary);
+    if (!m_File.is_open()) return false;
+
+    IndexHeader header{};
+    if (!ReadHeader(m_File, vaultPath, vaultSize, header)) return false;
+    if (header.bloomBlocks == 0 || header.slotCount == 0 || (header.slotCount & (header.slotCount - 1)) != 0) return false;
+
+    m_BloomBlocks = header.bloomBlocks;
+    m_SlotCount = header.slotCount;
+    m_IndexedSize = header.vaultSize;
+    m_Current = IsCurrent(indexPath, vaultPath);
+    return true;
+}
+
+uint64_t VaultIndex::IndexedSize() const {
+    return m_IndexedSize;
+}
+
+bool VaultIndex::IsCurrent(const std::filesystem::path& indexPath, const std::filesystem::path& vaultPath) {
+    std::error_code indexError, vaultError;
+    auto indexTime = std::filesystem::last_write_time(indexPath, indexError);
+    auto vaultTime = std::filesystem::last_write_time(vaultPath, vaultError);
+    return !indexError && !vaultError && indexTime >= vaultTime;
+}
+
+void VaultIndex::Refresh(const std::filesystem::path& indexPath, const std::filesystem::path& vaultPath) {
+    // The vault's own time rather than the clock, file times may be coarser than the clock or lag behind it
+    std::error_code error;
+    auto vaultTime = std::filesystem::last_write_time(vaultPath, error);
+    if (!error) std::filesystem::last_write_time(indexPath, vaultTime, error);
+}
+
+bool VaultIndex::IsCurrent() const {
+    return m_Current;
+}
+
+bool VaultIndex::ReadIndexedSize(const std::filesystem::path& indexPath, const std::filesystem::path& vaultPath, uint64_t vaultSize, uint64_t& indexedSize) {
+    std::ifstream file(indexPath, std::ios::binary);
+    IndexHeader header{};
+    if (!ReadHeader(file, vaultPath, vaultSize, header)) return false;
+    indexedSize = header.vaultSize;
+    return true;
+}
+
+bool VaultIndex::MayContain(uint64_t hash) {
+    unsigned char block[INDEX_BLOOM_BLOCK_BYTES];
+    m_File.seekg(sizeof(IndexHeader) + (hash % m_BloomBlocks) * INDEX_BLOOM_BLOCK_BYTES);
+    if (!m_File.read(reinterpret_cast<char*>(block), sizeof(block))) return true; // can't tell, let the caller look
+    return TestBloomBits(block, hash);
+}
+
+void VaultIndex::FindOffsets(uint64_t hash, std::vector<uint64_t>& offsets) {
+    const uint64_t slotsStart = sizeof(IndexHeader) + m_BloomBlocks * INDEX_BLOOM_BLOCK_BYTES;
+    IndexEntry batch[INDEX_PROBE_BATCH];
+    uint64_t slot = hash & (m_SlotCount - 1);
+
+    for (uint64_t visited = 0; visited < m_SlotCount;) {
+        uint64_t count = std::min<uint64_t>(INDEX_PROBE_BATCH, m_SlotCount - slot); // don't read past the table end
+        m_File.seekg(slotsStart + slot * sizeof(IndexEntry));
+        if (!m_File.read(reinterpret_cast<char*>(batch), count * sizeof(IndexEntry))) return;
+
+        for (uint64_t i = 0; i < count; ++i) {
+            if (batch[i].hash == 0) return; // empty slot ends the probe run
+            if (batch[i].hash == hash) offsets.push_back(batch[i].offset);
+        }
+        visited += count;
+        slot = (slot + count) & (m_SlotCount - 1);
+    }
+}
@@ -0,0 +1,345 @@
+/******************************************************************************
+ * Project: Password Manager - Console App
+ * File: vault_merge.cpp
+ * Description:
+ *   Compares copies of a vault and merges them (two-way or three-way with a
+ *   common base), streaming the files instead of loading them.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.2.0
+ * Author: Ghost
+ * Created On: 10-19-2026
+ * Last Modified: 10-19-2026
+ *****************************************************************************/
+
+#include "../include/vault_merge.h"
+#include "../include/custom_io.h"
+#include "../include/entry_metadata.h"
+#include "../include/vault_index.h"
+#include <algorithm>
+#include <fstream>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#define VM_WRITE_BUFFER (256 * 1024) // bytes of merged lines gathered before each write
+#define VM_MIN_SLOTS 1024
+
+// States of an entry of the other copy while the local vault is streamed
+#define VM_PENDING 0 // the local vault has not had the entry (yet)
+#define VM_DONE 1    // decided while streaming the local vault, not written from the other copy
+#define VM_TAKE 2    // decided while streaming the local vault, written from the other copy
+#define VM_REMOVED 0 // fingerprint of an entry removed by an appended change (hashes are never 0)
+
+// Flushes a written file to the disk, so a crash after the rename can't leave a partial vault behind.
+static bool SyncFile(const std::filesystem::path& path) {
+#ifdef _WIN32
+    HANDLE handle = CreateFileW(path.c_str(), GENERIC_WRITE, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (handle == INVALID_HANDLE_VALUE) return false;
+    bool synced = FlushFileBuffers(handle) != 0;
+    CloseHandle(handle);
+    return synced;
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    bool synced = fsync(fd) == 0;
+    close(fd);
+    return synced;
+#endif
+}
+
+// Moves `from` over `to` and makes the rename itself durable: the directory entry is flushed
+// (POSIX), or the move is written through (Windows).
+static bool ReplaceFile(const std::filesystem::path& from, const std::filesystem::path& to) {
+#ifdef _WIN32
+    return MoveFileExW(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+    std::error_code error;
+    std::filesystem::rename(from, to, error);
+    if (error) return false;
+
+    std::filesystem::path directory = to.parent_path();
+    int fd = open(directory.empty() ? "." : directory.c_str(), O_RDONLY | O_DIRECTORY);
+    if (fd < 0) return true; // renamed, only durability is not guaranteed
+    fsync(fd);
+    close(fd);
+    return true;
+#endif
+}
+
+/**
+ * @class FingerprintTable
+ * @brief Open addressing table from the hash of an encrypted name to the hash of its encrypted password.
+ *
+ * Hashes come from `VaultIndex::HashKey`, which never returns `0`, so a zero key marks an empty slot.
+ */
+class FingerprintTable {
+public:
+    struct Slot {
+        uint64_t key = 0;
+        uint64_t value = 0;
+        uint32_t state = VM_PENDING;
+    };
+
+    void Insert(uint64_t key, uint64_t value) {
+        if ((m_Count + 1) * 2 > m_Slots.size()) Grow();
+        Slot& slot = Probe(key);
+        if (slot.key == 0) m_Count++;
+        slot.key = key;
+        slot.value = value; // a repeated name keeps the last password, as when loading
+    }
+
+    Slot* Find(uint64_t key) {
+        if (m_Slots.empty()) return nullptr;
+        Slot& slot = Probe(key);
+        return slot.key != 0 ? &slot : nullptr;
+    }
+
+private:
+    Slot& Probe(uint64_t key) {
+        size_t mask = m_Slots.size() - 1;
+        size_t i = static_cast<size_t>(key) & mask;
+        while (m_Slots[i].key != 0 && m_Slots[i].key != key) i = (i + 1) & mask;
+        return m_Slots[i];
+    }
+
+    void Grow() {
+        std::vector<Slot> old(std::max<size_t>(VM_MIN_SLOTS, m_Slots.size() * 2));
+        old.swap(m_Slots);
+        for (const Slot& slot : old) {
+            if (slot.key != 0) Probe(slot.key) = slot;
+        }
+    }
+
+    std::vector<Slot> m_Slots;
+    size_t m_Count = 0;
+};
+
+// Reads a vault into a table of fingerprints, returns false if it could not be read.
+static bool LoadFingerprints(const std::filesystem::path& path, const IEncryption& encryption, FingerprintTable& table, EntryMetadata* metadata, size_t& damaged) {
+    size_t damagedLines = 0;
+    bool read = CustomIO::ScanFile(path, encryption, [&](const EncryptedRecord& record) {
+        table.Insert(VaultIndex::HashKey(record.app), record.removed ? VM_REMOVED : VaultIndex::HashKey(record.password));
+    }, metadata, &damagedLines);
+    damaged += damagedLines;
+    return read;
+}
+
+// Fingerprint of the final version of an entry, nullptr if the vault does not have it (any more).
+static const uint64_t* Present(const FingerprintTable::Slot* slot) {
+    return slot != nullptr && slot->value != VM_REMOVED ? &slot->value : nullptr;
+}
+
+// Tells whether `record` is the final version of its entry and was not handled yet, a vault with
+// appended changes holds earlier versions too (see `CustomIO::AppendChanges`).
+static bool IsFinal(FingerprintTable::Slot* slot, const EncryptedRecord& record) {
+    return !record.removed && slot != nullptr && slot->state == VM_PENDING && slot->value == VaultIndex::HashKey(record.password);
+}
+
+static bool SameVersion(const uint64_t* a, const uint64_t* b) {
+    return a == nullptr ? b == nullptr : b != nullptr && *a == *b;
+}
+
+// Last change of an entry, 0 (unknown) if it has no metadata.
+static int64_t ModifiedTime(const EntryMetadata& metadata, const std::string& app) {
+    size_t row = metadata.Row(app);
+    return row == EM_NO_ROW ? 0 : metadata.Modified(row);
+}
+
+/*
+ * Merge state shared by the passes. `ours`, `theirs` and `base` are the fingerprints of one entry
+ * on each side, `nullptr` where the side does not have it. Diff mode is a merge that always
+ * takes the other copy.
+ */
+struct MergeState {
+    const IEncryption& encryption;
+    MergePolicy policy;
+    bool diff;
+    MergeReport& report;
+    EntryMetadata oursMetadata, theirsMetadata;
+
+    // Decides whether the result holds the other copy's version of an entry
+    bool TakeTheirs(std::string_view encryptedApp, const uint64_t* base, const uint64_t* ours, const uint64_t* theirs, bool& conflict, std::string& app) {
+        conflict = false;
+        if (diff) return !SameVersion(ours, theirs);
+        if (SameVersion(ours, theirs) || SameVersion(base, theirs)) return false; // nothing new on their side
+        if (SameVersion(base, ours)) return true;                                 // changed on their side only
+
+        conflict = true;
+        if (policy != MergePolicy::Newest) return policy == MergePolicy::Theirs;
+        if (ours == nullptr || theirs == nullptr) return ours == nullptr; // a change beats a removal
+        app = Name(encryptedApp);
+        return ModifiedTime(theirsMetadata, app) > ModifiedTime(oursMetadata, app);
+    }
+
+    // Names are decrypted through the secure path like passwords, only the name itself is copied out
+    std::string Name(std::string_view encryptedApp) const {
+        SecureString app;
+        if (!encryption.decryptSecure(std::string(encryptedApp), app)) return std::string();
+        return std::string(app.data(), app.size());
+    }
+
+    void Record(std::string_view encryptedApp, std::string& app, MergeChange change, bool conflict) {
+        if (app.empty()) app = Name(encryptedApp);
+        switch (change) {
+        case MergeChange::Added: report.added++; break;
+        case MergeChange::Removed: report.removed++; break;
+        case MergeChange::Changed: report.changed++; break;
+        case MergeChange::Kept: report.unchanged++; break;
+        }
+        if (conflict) report.conflicts++;
+        report.entries.push_back({ app, change, conflict });
+    }
+};
+
+// Shared by Diff and Merge, `output` is empty in diff mode.
+static bool Run(const std::filesystem::path& base, const std::filesystem::path& ours, const std::filesystem::path& theirs,
+    const std::filesystem::path& output, const IEncryption& encryption, MergePolicy policy, MergeReport& report) {
+
+    report = MergeReport();
+    bool diff = output.empty();
+    MergeState state{ encryption, policy, diff, report, {}, {} };
+
+    // Every vault is reduced to the fingerprints of the final version of its entries, then streamed below
+    FingerprintTable baseTable, oursTable, theirsTable;
+    if (!base.empty() && !LoadFingerprints(base, encryption, baseTable, nullptr, report.damaged)) return false;
+    if (!LoadFingerprints(ours, encryption, oursTable, diff ? nullptr : &state.oursMetadata, report.damaged)) return false;
+    if (!LoadFingerprints(theirs, encryption, theirsTable, diff ? nullptr : &state.theirsMetadata, report.damaged)) return false;
+
+    std::filesystem::path tempPath = output;
+    tempPath += VM_TEMP_EXT;
+    std::ofstream file;
+    if (!diff) {
+        file.open(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) return false;
+    }
+
+    EntryMetadata merged = state.oursMetadata;
+    std::vector<IndexEntry> index;
+    uint64_t offset = 0;
+    std::string out;
+    out.reserve(VM_WRITE_BUFFER + 4096);
+    if (!diff) CustomIO::AppendFormatLine(out);
+
+    auto write = [&](const EncryptedRecord& record) {
+        if (diff) return;
+        index.push_back({ VaultIndex::HashKey(record.app), offset + out.size() });
+        CustomIO::AppendRecordLine(out, record.app, record.password);
+        if (out.size() >= VM_WRITE_BUFFER) {
+            file.write(out.data(), static_cast<std::streamsize>(out.size()));
+            offset += out.size();
+            out.clear();
+        }
+    };
+
+    // Metadata follows the version of the entry that is kept
+    auto takeMetadata = [&](const std::string& app, bool present) {
+        if (diff) return;
+        size_t row = state.theirsMetadata.Row(app);
+        if (present && row != EM_NO_ROW) merged.CopyRow(state.theirsMetadata, row);
+        else merged.Remove(app); // no stale history next to a password that came from the other copy
+    };
+
+    // Pass 1: stream the local vault, deciding every entry it has
+    bool read = CustomIO::ScanFile(ours, encryption, [&](const EncryptedRecord& record) {
+        uint64_t key = VaultIndex::HashKey(record.app);
+        FingerprintTable::Slot* oursSlot = oursTable.Find(key);
+        if (!IsFinal(oursSlot, record)) return;
+        oursSlot->state = VM_DONE;
+        FingerprintTable::Slot* theirsSlot = theirsTable.Find(key);
+        const uint64_t* theirsValue = Present(theirsSlot);
+
+        bool conflict;
+        std::string app;
+        bool takeTheirs = state.TakeTheirs(record.app, Present(baseTable.Find(key)), &oursSlot->value, theirsValue, conflict, app);
+        if (theirsSlot != nullptr) theirsSlot->state = takeTheirs ? VM_TAKE : VM_DONE;
+
+        if (!takeTheirs) {
+            write(record);
+            if (conflict) state.Record(record.app, app, MergeChange::Kept, true);
+            else report.unchanged++;
+            return;
+        }
+        state.Record(record.app, app, theirsValue != nullptr ? MergeChange::Changed : MergeChange::Removed, conflict);
+        if (theirsValue == nullptr) takeMetadata(app, false); // changed entries are written in pass 2
+    });
+
+    // Pass 2: stream the other copy, writing the entries taken from it and deciding the ones the local vault lacks
+    if (read) {
+        read = CustomIO::ScanFile(theirs, encryption, [&](const EncryptedRecord& record) {
+            FingerprintTable::Slot* theirsSlot = theirsTable.Find(VaultIndex::HashKey(record.app));
+            if (record.removed || theirsSlot == nullptr || theirsSlot->value != VaultIndex::HashKey(record.password)) return; // an earlier version
+            std::string app;
+
+            if (theirsSlot->state == VM_PENDING) { // the local vault does not have the entry (any more)
+                bool conflict;
+                if (state.TakeTheirs(record.app, Present(baseTable.Find(theirsSlot->key)), nullptr, &theirsSlot->value, conflict, app)) {
+                    state.Record(record.app, app, MergeChange::Added, conflict);
+                    theirsSlot->state = VM_TAKE;
+                }
+                else {
+                    if (conflict) state.Record(record.app, app, MergeChange::Kept, true);
+                    theirsSlot->state = VM_DONE;
+                }
+            }
+
+            if (theirsSlot->state != VM_TAKE) return;
+            theirsSlot->state = VM_DONE; // written once even if the name is repeated
+            write(record);
+            if (!diff) takeMetadata(app.empty() ? state.Name(record.app) : app, true);
+        });
+    }
+
+    if (diff) return read;
+
+    if (read && report.damaged == 0) {
+        if (merged.Size() > 0) CustomIO::AppendMetadataLine(out, merged, encryption);
+        file.write(out.data(), static_cast<std::streamsize>(out.size()));
+        offset += out.size();
+    }
+    file.close();
+
+    // A damaged input would look like removed entries, so nothing is written then. The merged
+    // file must be on the disk before it replaces the vault, or a crash could leave neither.
+    std::error_code error;
+    if (!read || report.damaged > 0 || !file || !SyncFile(tempPath)) {
+        std::filesystem::remove(tempPath, error);
+        return false;
+    }
+
+    // The old index would describe the old file, drop it before the new file takes its place
+    std::filesystem::path indexPath = CustomIO::GetIndexPath(output);
+    std::filesystem::remove(indexPath, error);
+    if (!ReplaceFile(tempPath, output)) {
+        std::filesystem::remove(tempPath, error);
+        return false;
+    }
+    if (!VaultIndex::Write(indexPath, index, output, offset)) std::filesystem::remove(indexPath, error);
+    return true;
+}
+
+bool VaultMerge::Diff(const std::filesystem::path& ours, const std::filesystem::path& theirs, const IEncryption& encryption, MergeReport& report) {
+    return Run(std::filesystem::path(), ours, theirs, std::filesystem::path(), encryption, MergePolicy::Theirs, report);
+}
+
+bool VaultMerge::Merge(const std::filesystem::path& base, const std::filesystem::path& ours, const std::filesystem::path& theirs,
+    const std::filesystem::path& output, const IEncryption& encryption, MergePolicy policy, MergeReport& report) {
+    if (output.empty()) return false;
+    return Run(base, ours, theirs, output, encryption, policy, report);
+}
+
+bool VaultMerge::ParsePolicy(const std::string& name, MergePolicy& policy) {
+    if (name == "ours") policy = MergePolicy::Ours;
+    else if (name == "theirs") policy = MergePolicy::Theirs;
+    else if (name == "newest") policy = MergePolicy::Newest;
+    else return false;
+    return true;
+}